@@ -0,0 +1,48 @@
+# Turns every shader in SHADER_DIR (*.vert, *.frag) into constexpr string
+# data in the header OUTPUT, so the executable needs no shader files at runtime.
+#
+# Usage: cmake -DSHADER_DIR=<dir> -DOUTPUT=<header> -P EmbedShaders.cmake
+
+if(NOT SHADER_DIR OR NOT OUTPUT)
+    message(FATAL_ERROR "EmbedShaders.cmake needs -DSHADER_DIR=... and -DOUTPUT=...")
+endif()
+
+# Raw string literal delimiter; a shader containing it cannot be embedded.
+set(DELIMITER "EDSHADER")
+
+file(GLOB SHADER_FILES "${SHADER_DIR}/*.vert" "${SHADER_DIR}/*.frag")
+list(SORT SHADER_FILES)
+
+set(ENTRIES "")
+foreach(SHADER_FILE IN LISTS SHADER_FILES)
+    get_filename_component(SHADER_NAME "${SHADER_FILE}" NAME)
+    file(READ "${SHADER_FILE}" SOURCE)
+    string(FIND "${SOURCE}" ")${DELIMITER}\"" CLASH)
+    if(NOT CLASH EQUAL -1)
+        message(FATAL_ERROR "${SHADER_NAME} contains the embedding delimiter )${DELIMITER}\"")
+    endif()
+    string(APPEND ENTRIES "    {\"${SHADER_NAME}\", R\"${DELIMITER}(${SOURCE})${DELIMITER}\"},\n")
+endforeach()
+
+set(CONTENT "// Generated by cmake/EmbedShaders.cmake from shaders/ -- do not edit.
+#pragma once
+
+#include <string_view>
+
+namespace EchoDrift::Rendering::EmbeddedShaders {
+
+struct Entry {
+    std::string_view name;   // File name inside shaders/, e.g. \"trail.vert\"
+    std::string_view source;
+};
+
+inline constexpr Entry ENTRIES[] = {
+${ENTRIES}};
+
+} // namespace EchoDrift::Rendering::EmbeddedShaders
+")
+
+# Only touch the header when a shader changed, so nothing rebuilds needlessly.
+file(WRITE "${OUTPUT}.tmp" "${CONTENT}")
+execute_process(COMMAND ${CMAKE_COMMAND} -E copy_if_different "${OUTPUT}.tmp" "${OUTPUT}")
+file(REMOVE "${OUTPUT}.tmp")
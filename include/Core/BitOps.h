@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace EchoDrift::Core {
+
+// Portable wrappers for the bit tricks the grid and trail code rely on:
+// compiler builtins where available, plain C++ otherwise.
+
+/**
+ * @brief Index of the lowest set bit. value must not be 0.
+ */
+inline int countTrailingZeros64(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(value);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<int>(index);
+#else
+    int index = 0;
+    while ((value & 1u) == 0) {
+        value >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+/**
+ * @brief Number of set bits.
+ */
+inline int popCount64(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(value);
+#else
+    // SWAR count (MSVC's __popcnt64 would need a POPCNT check at runtime)
+    value = value - ((value >> 1) & 0x5555555555555555ull);
+    value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+    value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return static_cast<int>((value * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+} // namespace EchoDrift::Core
@@ -2,9 +2,12 @@
 
 #include "Rendering/GLCommon.h"
 #include <memory>         // Needed for std::unique_ptr
+#include <cstdint>
 #include "Entities/Echo.h"
 #include "Rendering/Renderer.h"
 #include "Game/Grid.h"
+#include "Game/MoveValidator.h"
+#include "Game/OccupancyBitmap.h"
 #include "Core/Types.h" 
 
 // Forward Declaration for Ghost (Corrected Namespace!)
@@ -25,7 +28,10 @@ class GameManager {
 private:
     // --- Singleton Implementation ---
     // 1. Private default constructor to prevent direct instantiation.
-    GameManager() = default;
+    // Both defined in GameManager.cpp, where Ghost is a complete type: the
+    // implicit versions would instantiate m_ghosts' destructor here.
+    GameManager();
+    ~GameManager();
     
     // 2. Delete copy constructor and assignment operator. (CRITICAL for Singleton)
     GameManager(const GameManager&) = delete;
@@ -39,6 +45,7 @@ private:
     EchoDrift::Rendering::Renderer m_renderer; 
     
     // Grid Declaration (Composition using RAII)
+    // Declared before the entities so it outlives them: their trails free their cells on destruction.
     std::unique_ptr<EchoDrift::Game::Grid> m_grid;
     
     // The player's main object
@@ -50,6 +57,42 @@ private:
     // NEW: List of active Ghosts (Now the compiler can find EchoDrift::Entities::Ghost)
     std::vector<std::unique_ptr<EchoDrift::Entities::Ghost>> m_ghosts;
 
+    // --- Fixed-Timestep Simulation ---
+    // Seconds of simulation per tick. Every tick moves each entity at most one cell.
+    static constexpr float TICK_INTERVAL = EchoDrift::Entities::MOVE_INTERVAL;
+    // Upper bound on ticks run in a single frame while catching up.
+    static constexpr int MAX_CATCH_UP_TICKS = 5;
+
+    // Trail cap applied to every entity (0 = classic unbounded trails).
+    // A non-zero value gives the snake-like mode and caps per-entity memory.
+    std::size_t m_maxTrailLength = 0;
+
+    float m_tickAccumulator = 0.0f;    // Unsimulated time carried between frames
+    float m_interpolationAlpha = 0.0f; // Fraction of the next tick already elapsed
+    std::uint64_t m_tickCount = 0;     // Ticks simulated since Init
+
+    /**
+     * @brief Runs exactly one fixed simulation step for every entity:
+     * propose (per entity) -> resolve (engine-wide) -> apply (per entity).
+     */
+    void Tick();
+
+    /**
+     * @brief Judges every proposal in m_moves against the same world snapshot,
+     * filling m_moveResults. Independent of entity update order.
+     */
+    void resolveMoves();
+
+    // --- Per-Tick Scratch State (reused every tick to avoid reallocations) ---
+    std::vector<EchoDrift::Entities::Entity*> m_tickEntities; // Player first, then ghosts
+    EchoDrift::Game::MoveBatch m_moves;                      // One proposal per entity
+    std::vector<EchoDrift::Entities::MoveResult> m_moveResults;
+    std::vector<int> m_entityIndexById;                      // EntityId -> index in m_tickEntities (-1 = none)
+
+    // Target cells claimed this tick, and the ones claimed more than once.
+    EchoDrift::Game::OccupancyBitmap m_claimedCells;
+    EchoDrift::Game::OccupancyBitmap m_contestedCells;
+
 public:
     // --- Singleton Access ---
     static GameManager& GetInstance() {
@@ -63,6 +106,22 @@ public:
     void Update(float deltaTime);
     void Render();
 
+    /**
+     * @brief Stops the render thread and releases every GL resource (entities,
+     * grid, renderer). Call before glfwTerminate() destroys the context.
+     */
+    void Shutdown();
+
+    // Number of simulation ticks run so far (deterministic clock for replays/benchmarks)
+    std::uint64_t getTickCount() const { return m_tickCount; }
+
+    /**
+     * @brief Sets the trail cap (0 = unbounded) for every live entity and for
+     * those spawned later. Trails already longer are cut back immediately.
+     */
+    void setMaxTrailLength(std::size_t maxLength);
+    std::size_t getMaxTrailLength() const { return m_maxTrailLength; }
+
     // NEW: Setter for game state (used by Echo on collision)
     void setState(EchoDrift::Core::GameState newState) { m_currentState = newState; }
     
@@ -72,6 +131,9 @@ public:
     // NEW: Accessor for the Echo's trail (needed for Ghost collision)
     EchoDrift::Entities::Echo* getPlayerEcho() const { return m_playerEcho.get(); }
     
+    // Accessor for the shared Grid (boundaries + world occupancy map)
+    EchoDrift::Game::Grid* getGrid() const { return m_grid.get(); }
+
     // NEW: Accessor for Renderer (needed for Echo/Ghost render calls)
     EchoDrift::Rendering::Renderer& getRenderer() { return m_renderer; }
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Entity.h"
+#include "Entities/Trail.h"
 #include "Core/InputManager.h"
 #include "Rendering/Buffer.h" // New include for Buffer
 #include "Game/Grid.h"        // New include for Grid access
@@ -13,21 +14,26 @@ namespace EchoDrift::Entities {
 class Echo : public Entity {
 private:
     EchoDrift::Core::Direction m_currentDirection = EchoDrift::Core::Direction::NONE;
-    std::vector<Vec2> m_trailHistory;
-    
-    // NEW: The Echo owns its trail geometry buffer. (Composition)
-    std::unique_ptr<EchoDrift::Rendering::Buffer> m_buffer;
 
-    // Helper to generate trail vertices and upload to the buffer
-    void generateTrailGeometry(const EchoDrift::Game::Grid& grid);
+    // The Echo owns its trail: cells, geometry and Grid claim. (Composition)
+    Trail m_trail;
 
 public:
-    Echo(int startX, int startY); // Updated constructor
+    Echo(EchoDrift::Game::Grid* grid, int startX, int startY); // The start cell is claimed in the Grid's owner map
     
-    // ... handleInput, Update, Render overrides ...
+    // ... handleInput, proposeMove/resolveMove, Render overrides ...
     void handleInput(EchoDrift::Core::Direction d);
-    void Update(float dt) override;
+    Vec2 proposeMove(const EchoDrift::Game::Grid& grid) override;
+    void resolveMove(const Vec2& newPos, const MoveResult& result, EchoDrift::Game::Grid& grid) override;
     void Render() override;
+
+    // Read-only trail access (geometry, replays, ghost echoes)
+    const TrailLog& getTrailHistory() const { return m_trail.getCells(); }
+
+    /**
+     * @brief Caps the trail length (snake mode), see Trail::setMaxLength.
+     */
+    void setMaxTrailLength(std::size_t maxLength) { m_trail.setMaxLength(maxLength); }
     
     // CRITICAL: We need a way to get the Grid from the GameManager for coordinate mapping
     // We will assume a global accessor for the grid for simplicity in this step.
@@ -1,6 +1,14 @@
 #pragma once
 
 #include <iostream>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+// Forward declaration: Grid.h includes this header for Vec2.
+namespace EchoDrift::Game {
+    class Grid;
+}
 
 namespace EchoDrift::Entities {
 
@@ -13,6 +21,35 @@ struct Vec2 {
     int y;
     // Constructor for easy initialization
     Vec2(int x_ = 0, int y_ = 0) : x(x_), y(y_) {} 
+
+    bool operator==(const Vec2& other) const { return x == other.x && y == other.y; }
+    bool operator!=(const Vec2& other) const { return !(*this == other); }
+};
+
+
+/**
+ * @brief Small numeric handle for an entity, used to tag the cells it owns in
+ * the Grid's occupancy map. 0 and 0xFFFF are reserved (see Game/Grid.h).
+ */
+using EntityId = std::uint16_t;
+
+
+/**
+ * @enum MoveOutcome
+ * @brief The GameManager's verdict on a proposed move, decided for all entities at once.
+ */
+enum class MoveOutcome {
+    STAYED,  // No move was proposed (target == current position)
+    MOVED,   // Target cell was free and nobody else wanted it
+    WALL,    // Target lies outside the grid
+    TRAIL,   // Target is on a trail; MoveResult::other says whose
+    HEAD_ON, // Two or more entities tried to enter the same free cell
+    SWAP     // Two entities tried to move into each other's cells
+};
+
+struct MoveResult {
+    MoveOutcome outcome = MoveOutcome::STAYED;
+    EntityId other = 0; // Owner of the trail we hit (TRAIL) or the entity we swapped with (SWAP)
 };
 
 
@@ -22,6 +59,7 @@ struct Vec2 {
  * Enforces a common interface using Pure Virtual Functions.
  */
 
+// Length of one fixed simulation tick in seconds. Entities move one cell per tick.
 constexpr float MOVE_INTERVAL = 0.2f;
 
 class Entity {
@@ -30,30 +68,54 @@ private:
     // The current position of the entity on the grid.
     Vec2 m_position;
 
+    // Position at the start of the current tick, for render interpolation.
+    Vec2 m_previousPosition;
+
+    // Unique ID written into the Grid's owner map for every cell we occupy.
+    EntityId m_id;
+
+    // IDs are handed out in construction order, starting at 1 (0 = empty cell),
+    // and a destroyed entity's ID is reused before a new one is minted, so the
+    // counter never runs into the reserved 0xFFFF (wall) or wraps to 0 (empty).
+    static constexpr EntityId MAX_ID = 0xFFFE;
+    static inline EntityId s_nextId = 1;
+    static inline std::vector<EntityId> s_freeIds;
+
+    static EntityId acquireId() {
+        if (!s_freeIds.empty()) {
+            const EntityId id = s_freeIds.back();
+            s_freeIds.pop_back();
+            return id;
+        }
+        if (s_nextId > MAX_ID) {
+            // 65534 live entities: every usable ID is taken.
+            throw std::length_error("Entity: out of entity IDs");
+        }
+        return s_nextId++;
+    }
+
 protected:
     // Protected allows derived classes (Echo, Ghost) to access the position directly,
     // but keeps it private from outside systems (GameManager).
     void setPosition(const Vec2& pos) { m_position = pos; }
 
-    // NEW: Timer to control when the entity moves
-    float m_moveTimer = 0.0f;
-
 public:
     // --- Public Interface ---
-    Entity(int startX, int startY) : m_position(startX, startY) {}
+    Entity(int startX, int startY) : m_position(startX, startY), m_previousPosition(startX, startY), m_id(acquireId()) {}
     
     // CRUCIAL FOR POLYMORPHISM: Allows derived class destructors to be called
     // when deleted via an Entity* pointer.
-    virtual ~Entity() = default; 
+    // Runs after the derived members are gone, so an entity's Trail has already
+    // freed its cells in the Grid by the time the ID goes back to the pool.
+    virtual ~Entity() { s_freeIds.push_back(m_id); }
+
+    // An ID belongs to exactly one entity (it is released on destruction).
+    Entity(const Entity&) = delete;
+    Entity& operator=(const Entity&) = delete; 
 
     // --- Pure Virtual Methods (Abstraction) ---
     // Derived classes MUST implement these methods.
     
-    /**
-     * @brief Logic update function.
-     * @param dt Delta time since last frame.
-     */
-
     /**
      * @brief Rendering function.
      */
@@ -61,9 +123,27 @@ public:
     
     // Accessor (Getter)
     Vec2 getPosition() const { return m_position; }
+    Vec2 getPreviousPosition() const { return m_previousPosition; }
+    EntityId getId() const { return m_id; }
 
-    // Make Update take delta time (dt) for the timer
-    virtual void Update(float dt) = 0;
+    /**
+     * @brief Records the current position as the start of a new tick.
+     * Called by the GameManager before any entity moves.
+     */
+    void BeginTick() { m_previousPosition = m_position; }
+
+    /**
+     * @brief Tick phase 1: returns the cell this entity wants to enter this tick
+     * (its current position to stay put). Must not modify the Grid or any other
+     * entity, so all proposals can be gathered independently.
+     */
+    virtual Vec2 proposeMove(const EchoDrift::Game::Grid& grid) = 0;
+
+    /**
+     * @brief Tick phase 3: applies the resolution pass's verdict on our proposal.
+     * On MOVED the entity claims newPos in the Grid and updates its trail.
+     */
+    virtual void resolveMove(const Vec2& newPos, const MoveResult& result, EchoDrift::Game::Grid& grid) = 0;
 };
 
 } // namespace EchoDrift::Entities 
\ No newline at end of file
@@ -1,10 +1,12 @@
 #pragma once
 
 #include "Entity.h"
+#include "Entities/Trail.h"
 #include "Rendering/Buffer.h" 
 #include "Game/Grid.h"       
 #include <vector>
 #include <memory>
+#include <random>
 
 namespace EchoDrift::Entities {
 
@@ -15,25 +17,29 @@ namespace EchoDrift::Entities {
  */
 class Ghost : public Entity {
 private:
-    // The Ghost's trail history (its own deadly line)
-    std::vector<Vec2> m_trailHistory;
-    
-    // The Ghost's geometry buffer (Composition)
-    std::unique_ptr<EchoDrift::Rendering::Buffer> m_buffer;
+    // The Ghost's deadly line: cells, geometry and Grid claim (Composition)
+    Trail m_trail;
 
-    // Helper to generate trail vertices for the Renderer
-    void generateTrailGeometry(const EchoDrift::Game::Grid& grid);
+    // Per-ghost random generator, so proposeMove only touches this ghost's state.
+    std::mt19937 m_rng;
 
     // Simple AI helper function
     EchoDrift::Core::Direction decideMove(const EchoDrift::Game::Grid& grid);
 
 public:
     // Constructor uses the base Entity constructor
-    Ghost(int startX, int startY); 
+    // The start cell is claimed in the Grid's owner map immediately.
+    Ghost(EchoDrift::Game::Grid* grid, int startX, int startY); 
 
     // --- Polymorphic Overrides ---
-    void Update(float dt) override;
+    Vec2 proposeMove(const EchoDrift::Game::Grid& grid) override;
+    void resolveMove(const Vec2& newPos, const MoveResult& result, EchoDrift::Game::Grid& grid) override;
     void Render() override;
+
+    /**
+     * @brief Caps the trail length (snake mode), see Trail::setMaxLength.
+     */
+    void setMaxTrailLength(std::size_t maxLength) { m_trail.setMaxLength(maxLength); }
 };
 
 } // namespace EchoDrift::Entities
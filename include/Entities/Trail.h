@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Entities/Entity.h"
+#include "Entities/TrailLog.h"
+#include "Entities/TrailMesh.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace EchoDrift::Entities {
+
+/**
+ * @class Trail
+ * @brief One entity's trail: the visited cells (TrailLog), their geometry
+ * (TrailMesh) and their claim in the Grid's owner map, kept in step.
+ *
+ * Echo and Ghost own one each, so growing the trail, expiring its tail and
+ * applying a length cap happen in exactly one place.
+ */
+class Trail {
+private:
+    EchoDrift::Game::Grid& m_grid;
+    EntityId m_owner;
+
+    TrailLog m_cells; // Every visited cell, 2 bits per step
+    TrailMesh m_mesh;
+
+    // Maximum cells kept (0 = unlimited). Older cells expire.
+    std::size_t m_maxLength = 0;
+
+    /**
+     * @brief Drops the oldest cell: frees it in the Grid and moves the mesh's tail.
+     */
+    void expireTail();
+
+public:
+    /**
+     * @brief Starts the trail at start, claiming it in the grid for owner.
+     * @param batch Shared trail storage (Renderer::getTrailBatch()).
+     * @param r,g,b Trail color, 0..1.
+     */
+    Trail(EchoDrift::Game::Grid& grid, EntityId owner, const Vec2& start, std::uint64_t tick,
+          EchoDrift::Rendering::TrailBatch& batch, float r, float g, float b);
+
+    /**
+     * @brief Frees every cell still claimed, so the owner's ID can be reused
+     * (Entity releases it after its members are destroyed) without the next
+     * entity to get that ID inheriting these walls.
+     */
+    ~Trail();
+
+    Trail(const Trail&) = delete;
+    Trail& operator=(const Trail&) = delete;
+
+    /**
+     * @brief Adds the cell just entered as the new head and claims it; in
+     * bounded mode the oldest cell falls off (at most one: one cell was added).
+     * @param tick The current simulation tick (GameManager::getTickCount()).
+     */
+    void Extend(const Vec2& cell, std::uint64_t tick);
+
+    /**
+     * @brief Caps the trail length (snake mode). 0 restores the unbounded trail.
+     * The head cell is always kept, so a limit of 1 means "no trail". A trail
+     * already over the new limit is cut back immediately.
+     */
+    void setMaxLength(std::size_t maxLength);
+    std::size_t getMaxLength() const { return m_maxLength; }
+
+    const TrailLog& getCells() const { return m_cells; }
+
+    /**
+     * @brief Queues the trail for the frame's batched trail draw.
+     */
+    void Submit() const { m_mesh.Submit(); }
+};
+
+} // namespace EchoDrift::Entities
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "Entities/Entity.h" // For Vec2
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+
+namespace EchoDrift::Entities {
+
+/**
+ * @class TrailLog
+ * @brief Compact list of the cells an entity has visited.
+ *
+ * Every step between neighbouring cells is stored as a 2-bit direction code
+ * (32 steps per 64-bit word). Absolute positions ("keyframes") are stored at
+ * index 0, every KEYFRAME_INTERVAL steps, and after any step that is not to a
+ * neighbouring cell. That costs about 0.27 bytes per cell instead of 8 for a
+ * std::vector<Vec2>.
+ *
+ * Storage is a pair of deques used as ring buffers: new steps go on the back,
+ * expired ones come off the front, so a length-capped trail has bounded memory.
+ *
+ * - push_back / pop_front / front / back: O(1)
+ * - operator[]: binary search over keyframes (O(log n)), then a popcount walk
+ *   of at most KEYFRAME_INTERVAL / 32 words
+ * - iteration: forward, yields Vec2 by value
+ */
+class TrailLog {
+public:
+    static constexpr std::size_t KEYFRAME_INTERVAL = 1024;
+    static constexpr std::size_t STEPS_PER_WORD = 32;
+
+    class const_iterator;
+
+private:
+    struct Keyframe {
+        std::size_t index;
+        Vec2 position;
+    };
+
+    // Indices below are absolute: they keep counting up as the front expires.
+    // 2-bit step codes. Bit pair (i % 32) of word (i / 32 - m_firstWord) holds
+    // the step that led to element i. The high bit selects the axis
+    // (0 = y, 1 = x), the low bit the sign (see encodeStep).
+    std::deque<std::uint64_t> m_steps;
+    std::size_t m_firstWord = 0;
+
+    // Sorted by index. m_keyframes.front() always describes the current front.
+    std::deque<Keyframe> m_keyframes;
+
+    std::size_t m_begin = 0; // Absolute index of front()
+    std::size_t m_end = 0;   // Absolute index one past back()
+    Vec2 m_back;
+
+    // Returns the 2-bit code for a unit step, or -1 if it is not one.
+    static int encodeStep(const Vec2& from, const Vec2& to);
+    static Vec2 applyStep(const Vec2& from, unsigned code);
+
+    unsigned stepCode(std::size_t index) const {
+        return static_cast<unsigned>(m_steps[index / STEPS_PER_WORD - m_firstWord] >> ((index % STEPS_PER_WORD) * 2)) & 3u;
+    }
+
+public:
+    TrailLog() = default;
+
+    void push_back(const Vec2& position);
+
+    /**
+     * @brief Drops the oldest cell (tail expiry). The trail must not be empty.
+     */
+    void pop_front();
+
+    void clear();
+
+    std::size_t size() const { return m_end - m_begin; }
+    bool empty() const { return m_end == m_begin; }
+
+    Vec2 front() const { return m_keyframes.front().position; }
+    Vec2 back() const { return m_back; }
+
+    /**
+     * @brief Random access: position of the i-th visited cell (i < size()).
+     */
+    Vec2 operator[](std::size_t index) const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    /**
+     * @brief Bytes of encoded trail data (for memory stats; excludes deque bookkeeping).
+     */
+    std::size_t getMemoryBytes() const {
+        return m_steps.size() * sizeof(std::uint64_t) + m_keyframes.size() * sizeof(Keyframe);
+    }
+
+    /**
+     * @class const_iterator
+     * @brief Forward iterator that decodes one step per increment.
+     */
+    class const_iterator {
+    private:
+        const TrailLog* m_log = nullptr;
+        std::size_t m_index = 0;
+        std::size_t m_nextKeyframe = 0; // Index into m_log->m_keyframes
+        Vec2 m_position;
+
+        friend class TrailLog;
+        const_iterator(const TrailLog* log, std::size_t index) : m_log(log), m_index(index) {
+            if (m_index < m_log->m_end) {
+                m_position = m_log->m_keyframes[0].position;
+                m_nextKeyframe = 1;
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Vec2;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Vec2*;
+        using reference = const Vec2&;
+
+        const_iterator() = default;
+
+        reference operator*() const { return m_position; }
+        pointer operator->() const { return &m_position; }
+
+        const_iterator& operator++() {
+            if (++m_index >= m_log->m_end) return *this;
+
+            const auto& keyframes = m_log->m_keyframes;
+            if (m_nextKeyframe < keyframes.size() && keyframes[m_nextKeyframe].index == m_index) {
+                m_position = keyframes[m_nextKeyframe++].position;
+            } else {
+                m_position = TrailLog::applyStep(m_position, m_log->stepCode(m_index));
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        bool operator==(const const_iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const const_iterator& other) const { return m_index != other.m_index; }
+    };
+};
+
+inline TrailLog::const_iterator TrailLog::begin() const { return const_iterator(this, m_begin); }
+inline TrailLog::const_iterator TrailLog::end() const { return const_iterator(this, m_end); }
+
+} // namespace EchoDrift::Entities
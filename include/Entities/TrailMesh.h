@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Entities/Entity.h"   // For Vec2
+#include "Rendering/TrailBatch.h"
+#include <cstdint>
+#include <deque>
+
+namespace EchoDrift::Entities {
+
+/**
+ * @class TrailMesh
+ * @brief GPU geometry for one entity's trail, kept in step with its TrailLog.
+ *
+ * Only the corners of the trail are stored: the tail, every turn, and the
+ * head. While the entity keeps going straight the head vertex is moved in
+ * place instead of adding a new one, and an expiring tail slides the first
+ * vertex forward until it reaches the next corner. A GL_LINE_STRIP through
+ * these points draws exactly the same trail with far fewer vertices, and each
+ * tick uploads at most one vertex.
+ *
+ * Vertices are raw grid cells plus the trail color and the tick each cell was
+ * laid down (12 bytes); the trail shader maps cells to NDC and derives the
+ * age-based fade from the tick, so neither needs per-frame CPU work.
+ * The vertices live in a range of the Renderer's shared TrailBatch, so all
+ * trails are drawn together with one multi-draw.
+ */
+class TrailMesh {
+private:
+    EchoDrift::Rendering::TrailBatch& m_batch;
+    EchoDrift::Rendering::TrailBatch::RangeId m_range;
+
+    // RGBA8, written into every vertex.
+    GLubyte m_color[4];
+
+    struct Corner {
+        Vec2 cell;
+        GLuint tick; // When the cell was laid down
+    };
+
+    // CPU copy of the grid cells behind the live vertices (corners only).
+    std::deque<Corner> m_corners;
+
+    EchoDrift::Rendering::TrailVertex makeVertex(const Corner& corner) const;
+    void uploadCorner(GLsizei index);
+
+public:
+    /**
+     * @param batch Shared trail storage (Renderer::getTrailBatch()).
+     * @param r,g,b Trail color, 0..1.
+     */
+    TrailMesh(EchoDrift::Rendering::TrailBatch& batch, float r, float g, float b);
+    ~TrailMesh();
+
+    TrailMesh(const TrailMesh&) = delete;
+    TrailMesh& operator=(const TrailMesh&) = delete;
+
+    /**
+     * @brief Adds a newly visited cell as the new head of the line strip.
+     * @param tick The current simulation tick (GameManager::getTickCount()).
+     */
+    void AppendCell(const Vec2& cell, std::uint64_t tick);
+
+    /**
+     * @brief Moves the tail to newTail after the oldest cell expired
+     * (mirrors TrailLog::pop_front; pass the TrailLog's new front()).
+     */
+    void ExpireTail(const Vec2& newTail);
+
+    /**
+     * @brief Queues this trail for the frame's batched trail draw.
+     */
+    void Submit() const { m_batch.Submit(m_range); }
+};
+
+} // namespace EchoDrift::Entities
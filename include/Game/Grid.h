@@ -3,10 +3,32 @@
 #include "Entities/Entity.h" // For the Vec2 struct
 #include "Rendering/GLCommon.h"
 #include "Rendering/Buffer.h" // Include the new Buffer header
+#include "Game/SparseOccupancy.h"
+#include <memory>
+#include <vector>
+
+namespace EchoDrift::Rendering {
+    class Renderer;
+}
 
 namespace EchoDrift::Game {
 
 using EchoDrift::Entities::Vec2;
+using EchoDrift::Entities::EntityId;
+
+// Reserved owner values in the Grid's occupancy map.
+constexpr EntityId EMPTY_OWNER = 0;      // Nobody has been here
+constexpr EntityId WALL_OWNER = 0xFFFF;  // Returned for any cell outside the grid
+static_assert(EMPTY_OWNER == SparseOccupancy::NO_OWNER, "Grid and its owner tiles must agree on 'free'");
+
+/**
+ * @enum GridRenderMode
+ * @brief How the grid lines are drawn.
+ */
+enum class GridRenderMode {
+    PROCEDURAL, // One fullscreen triangle; lines computed per pixel (constant cost, no VBO)
+    LINES       // One GL_LINES pair per grid line from a VBO (cost grows with grid size)
+};
 
 /**
  * @class Grid
@@ -18,8 +40,16 @@ private:
     const int m_width;
     const int m_height;
     const float m_cellSize; // Size of one grid cell in normalized screen coordinates (NDC).
+    const GridRenderMode m_renderMode;
+
+    // --- World Occupancy ---
+    // One owner ID per cell, stored in 64x64 tiles allocated on first claim
+    // (plus a summary bitmap), so a 65536x65536 arena costs memory only where
+    // trails have been. Every entity writes its ID here as it moves, so "who is
+    // on this cell?" is an O(1) lookup for the player, ghosts and pickups alike.
+    SparseOccupancy m_occupancy;
 
-    // The Grid now owns a Buffer object.
+    // The Grid now owns a Buffer object (LINES mode only).
     std::unique_ptr<EchoDrift::Rendering::Buffer> m_buffer;
 
     // --- Rendering Data (Modern OpenGL) ---
@@ -33,7 +63,7 @@ private:
     void setupBuffers(); 
 
 public:
-    Grid(int width, int height, float cellSize);
+    Grid(int width, int height, float cellSize, GridRenderMode renderMode = GridRenderMode::PROCEDURAL);
     ~Grid(); // Crucial for cleaning up OpenGL buffers (RAII concept)
 
     /**
@@ -44,9 +74,55 @@ public:
     Vec2 gridToScreen(const Vec2& gridPos) const;
 
     /**
-     * @brief Draws the grid lines using the OpenGL buffers.
+     * @brief Float version of gridToScreen for fractional (interpolated) grid positions.
+     */
+    void gridToScreen(float gridX, float gridY, float& screenX, float& screenY) const;
+
+    /**
+     * @brief Records the grid lines as a background draw (in the Grid's render mode).
+     */
+    void Render(EchoDrift::Rendering::Renderer& renderer) const;
+
+    // --- Occupancy Queries ---
+
+    bool isInBounds(const Vec2& gridPos) const {
+        return gridPos.x >= 0 && gridPos.x < m_width && gridPos.y >= 0 && gridPos.y < m_height;
+    }
+
+    /**
+     * @brief Returns the ID of the entity whose trail covers this cell.
+     * @return EMPTY_OWNER for a free cell, WALL_OWNER for anything outside the grid.
+     */
+    EntityId getOwner(const Vec2& gridPos) const {
+        if (!isInBounds(gridPos)) return WALL_OWNER;
+        return m_occupancy.getOwner(gridPos.x, gridPos.y);
+    }
+
+    /**
+     * @brief Marks a cell as owned by an entity (or frees it with EMPTY_OWNER).
+     * The position must be in bounds.
+     */
+    void setOwner(const Vec2& gridPos, EntityId owner) {
+        m_occupancy.setOwner(gridPos.x, gridPos.y, owner);
+    }
+
+    /**
+     * @brief True if no entity owns any cell in the rectangle [x, x + w) x [y, y + h).
+     * Skips empty 64x64 tiles wholesale through the owner map's summary bitmap.
+     */
+    bool isAreaEmpty(int x, int y, int w, int h) const {
+        return m_occupancy.isRectEmpty(x, y, w, h);
+    }
+
+    /**
+     * @brief Frees every cell (e.g. when restarting a round).
+     */
+    void clearOwners();
+
+    /**
+     * @brief The tiled owner map itself, for batched (SIMD) queries.
      */
-    void Render(); 
+    const SparseOccupancy& getOccupancy() const { return m_occupancy; }
 
     // Accessors for boundaries (Encapsulation provides read-only access)
     int getWidth() const { return m_width; }
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Game/Grid.h"
+#include <cstdint>
+#include <vector>
+
+namespace EchoDrift::Game {
+
+/**
+ * @struct MoveBatch
+ * @brief Candidate moves for many entities, stored as separate x/y arrays
+ * (struct-of-arrays) so the validator can load eight of them at once.
+ */
+struct MoveBatch {
+    std::vector<std::int32_t> x;
+    std::vector<std::int32_t> y;
+
+    // Output of MoveValidator::Validate: the owner of each target cell
+    // (EMPTY_OWNER = free, WALL_OWNER = out of bounds).
+    std::vector<EntityId> owners;
+
+    void clear() { x.clear(); y.clear(); owners.clear(); }
+
+    void push(const Vec2& candidate) {
+        x.push_back(candidate.x);
+        y.push_back(candidate.y);
+    }
+
+    std::size_t size() const { return x.size(); }
+    Vec2 position(std::size_t i) const { return Vec2(x[i], y[i]); }
+};
+
+/**
+ * @class MoveValidator
+ * @brief Checks bounds and occupancy for a whole batch of candidate moves in one pass.
+ *
+ * On x86 CPUs with AVX2 the tiled owner map is read with 8-wide gathers (tile
+ * pointers first, then the owners through them); everywhere else (or on older
+ * CPUs) a scalar loop is used. The choice is made once at runtime, so the same
+ * binary runs on any machine.
+ */
+class MoveValidator {
+public:
+    /**
+     * @brief Fills batch.owners with the Grid owner of every candidate cell.
+     */
+    static void Validate(const Grid& grid, MoveBatch& batch);
+
+    /**
+     * @brief True if Validate() dispatches to the AVX2 kernel on this machine.
+     */
+    static bool usingAVX2();
+};
+
+} // namespace EchoDrift::Game
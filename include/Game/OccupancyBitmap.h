@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace EchoDrift::Game {
+
+/**
+ * @class OccupancyBitmap
+ * @brief Packed one-bit-per-cell map of which grid cells are taken.
+ *
+ * The playfield is surrounded by a one-cell border whose bits are always set,
+ * so a single test() answers both "is this cell on my trail?" and "is this
+ * cell outside the grid?". Coordinates passed in must be at most one cell
+ * outside the grid, which always holds for a single step from a valid cell.
+ */
+class OccupancyBitmap {
+private:
+    int m_width = 0;       // Playfield width (without border)
+    int m_height = 0;      // Playfield height (without border)
+    int m_stride = 0;      // Row length including the border (m_width + 2)
+    std::vector<std::uint64_t> m_words;
+
+    // Maps a (possibly border) grid coordinate to its bit index.
+    std::size_t bitIndex(int x, int y) const {
+        return static_cast<std::size_t>(y + 1) * static_cast<std::size_t>(m_stride)
+             + static_cast<std::size_t>(x + 1);
+    }
+
+    void setBit(std::size_t bit) { m_words[bit >> 6] |= (std::uint64_t{1} << (bit & 63)); }
+
+public:
+    OccupancyBitmap() = default;
+    OccupancyBitmap(int width, int height) { resize(width, height); }
+
+    /**
+     * @brief Re-allocates the bitmap for a new grid size and clears the playfield.
+     */
+    void resize(int width, int height);
+
+    /**
+     * @brief Clears every playfield cell (the border stays set).
+     */
+    void clear();
+
+    /**
+     * @brief Returns true if the cell is occupied or lies on the border.
+     */
+    bool test(int x, int y) const {
+        const std::size_t bit = bitIndex(x, y);
+        return (m_words[bit >> 6] >> (bit & 63)) & 1u;
+    }
+
+    void set(int x, int y) { setBit(bitIndex(x, y)); }
+
+    void reset(int x, int y) {
+        const std::size_t bit = bitIndex(x, y);
+        m_words[bit >> 6] &= ~(std::uint64_t{1} << (bit & 63));
+    }
+
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+};
+
+} // namespace EchoDrift::Game
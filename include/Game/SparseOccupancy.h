@@ -0,0 +1,147 @@
+#pragma once
+
+#include "Entities/Entity.h" // For EntityId
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace EchoDrift::Game {
+
+/**
+ * @class SparseOccupancy
+ * @brief Two-level owner map for very large arenas (up to 65536x65536).
+ *
+ * Level 1 is a grid of 64x64-cell tiles, each holding the owner ID of every
+ * cell (8 KiB) plus a 64-row occupancy bitmap (512 bytes), allocated the first
+ * time one of its cells is claimed. Level 2 is a summary bitmap with one bit
+ * per tile ("this tile has at least one occupied cell"). Memory follows the
+ * part of the arena entities have visited, not its area.
+ *
+ * Point queries are O(1) through a tile table; rectangle queries skip empty
+ * tiles 64 at a time through the summary words and only look inside tiles
+ * that are non-empty.
+ */
+class SparseOccupancy {
+public:
+    static constexpr int TILE_SHIFT = 6;
+    static constexpr int TILE_SIZE = 1 << TILE_SHIFT; // 64 cells per tile side
+    static constexpr int TILE_MASK = TILE_SIZE - 1;
+    static constexpr int TILE_CELLS = TILE_SIZE * TILE_SIZE;
+
+    // Owner of a free cell (matches Game::EMPTY_OWNER).
+    static constexpr EchoDrift::Entities::EntityId NO_OWNER = 0;
+
+    /**
+     * @brief Index of cell (x, y) inside its tile's owner array.
+     */
+    static int cellIndex(int x, int y) { return ((y & TILE_MASK) << TILE_SHIFT) | (x & TILE_MASK); }
+
+private:
+    // One trailing padding entry so 32-bit SIMD gathers of the last cell stay in range.
+    using OwnerArray = std::array<EchoDrift::Entities::EntityId, TILE_CELLS + 1>;
+
+    struct Tile {
+        OwnerArray owners{};                         // row-major within the tile, see cellIndex()
+        std::array<std::uint64_t, TILE_SIZE> rows{}; // bit c of rows[r] = cell (c, r) in the tile
+        std::uint32_t count = 0;                     // occupied cells in this tile
+    };
+
+    // Shared stand-in for tiles never written, so lookups need no null check.
+    static const OwnerArray s_emptyOwners;
+
+    int m_width = 0;
+    int m_height = 0;
+    int m_tilesX = 0;
+    int m_tilesY = 0;
+    int m_summaryStride = 0; // 64-bit summary words per row of tiles
+
+    std::vector<std::unique_ptr<Tile>> m_tiles; // m_tilesX * m_tilesY, nullptr = never written
+    std::vector<std::uint64_t> m_summary;       // one bit per tile, set while count > 0
+
+    // Per tile: its owner array, or s_emptyOwners while unallocated.
+    std::vector<const EchoDrift::Entities::EntityId*> m_tileOwners;
+
+    std::size_t tileIndex(int tx, int ty) const {
+        return static_cast<std::size_t>(ty) * m_tilesX + tx;
+    }
+
+    bool summaryBit(int tx, int ty) const {
+        return (m_summary[static_cast<std::size_t>(ty) * m_summaryStride + (tx >> 6)] >> (tx & 63)) & 1u;
+    }
+
+    void setSummaryBit(int tx, int ty, bool value);
+
+    Tile& tileForWrite(int tx, int ty);
+
+public:
+    SparseOccupancy() = default;
+    SparseOccupancy(int width, int height) { resize(width, height); }
+
+    /**
+     * @brief Re-sizes the arena and frees every tile.
+     */
+    void resize(int width, int height);
+
+    /**
+     * @brief Frees every tile (all cells become empty).
+     */
+    void clear();
+
+    bool isInBounds(int x, int y) const {
+        return static_cast<std::uint32_t>(x) < static_cast<std::uint32_t>(m_width) &&
+               static_cast<std::uint32_t>(y) < static_cast<std::uint32_t>(m_height);
+    }
+
+    /**
+     * @brief O(1) point query. Cells outside the arena report as occupied.
+     */
+    bool test(int x, int y) const {
+        if (!isInBounds(x, y)) return true;
+        const Tile* tile = m_tiles[tileIndex(x >> TILE_SHIFT, y >> TILE_SHIFT)].get();
+        return tile && ((tile->rows[y & TILE_MASK] >> (x & TILE_MASK)) & 1u);
+    }
+
+    /**
+     * @brief O(1) owner lookup. The cell must be in bounds.
+     * @return NO_OWNER for a free cell.
+     */
+    EchoDrift::Entities::EntityId getOwner(int x, int y) const {
+        return m_tileOwners[tileIndex(x >> TILE_SHIFT, y >> TILE_SHIFT)][cellIndex(x, y)];
+    }
+
+    /**
+     * @brief Sets a cell's owner (NO_OWNER frees it), allocating its tile on
+     * the first claim. Tiles stay allocated once touched so a trail sweeping
+     * back and forth does not churn the allocator. Out-of-bounds cells are ignored.
+     */
+    void setOwner(int x, int y, EchoDrift::Entities::EntityId owner);
+
+    /**
+     * @brief True if no cell in [x, x + w) x [y, y + h) is occupied.
+     * Rectangles that leave the arena are never empty.
+     */
+    bool isRectEmpty(int x, int y, int w, int h) const;
+
+    /**
+     * @brief True if the 64x64 tile containing (x, y) has no occupied cells.
+     * Lets look-ahead code jump a whole tile at a time.
+     */
+    bool isTileEmpty(int x, int y) const {
+        return isInBounds(x, y) && !summaryBit(x >> TILE_SHIFT, y >> TILE_SHIFT);
+    }
+
+    std::size_t getAllocatedTileCount() const;
+
+    /**
+     * @brief Tile table for batched (SIMD) lookups: entry ty * getTilesX() + tx
+     * is that tile's owner array (indexed by cellIndex()), never null.
+     */
+    const EchoDrift::Entities::EntityId* const* getTileOwners() const { return m_tileOwners.data(); }
+    int getTilesX() const { return m_tilesX; }
+
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+};
+
+} // namespace EchoDrift::Game
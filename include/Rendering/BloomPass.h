@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Rendering/GLCommon.h"
+#include "Rendering/RenderTarget.h"
+#include "Rendering/Shader.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace EchoDrift::Rendering {
+
+class GpuTimer;
+
+/**
+ * @enum BloomQuality
+ * @brief Cost tiers for the bloom chain (lower tiers for integrated GPUs and
+ * software rasterizers).
+ */
+enum class BloomQuality : std::uint8_t {
+    OFF,    // No offscreen target at all: the scene draws straight to the window
+    LOW,    // 3 levels from quarter resolution
+    MEDIUM, // 4 levels from half resolution
+    HIGH    // 6 levels from half resolution
+};
+
+/**
+ * @class BloomPass
+ * @brief Dual-filter (dual Kawase) bloom over an HDR scene texture.
+ *
+ * The scene is bright-passed into the first level, then blurred down a chain
+ * of half-size levels (5 bilinear taps each) and back up (8 taps, added onto
+ * the level above), and finally added onto the scene in the composite. Every
+ * tap reads between texels, so the bilinear filter does half the work; the
+ * cost is dominated by the first level, which is why the tiers differ in
+ * where the chain starts as much as in its length.
+ *
+ * GL thread only. The three steps are timed as separate GpuTimer passes.
+ */
+class BloomPass {
+private:
+    std::unique_ptr<Shader> m_downShader;
+    std::unique_ptr<Shader> m_upShader;
+    std::unique_ptr<Shader> m_compositeShader;
+
+    UniformVec2 m_downHalfPixel;
+    UniformFloat m_downThreshold;
+    UniformVec2 m_upHalfPixel;
+    UniformFloat m_compositeIntensity;
+
+    BloomQuality m_quality = BloomQuality::MEDIUM;
+    std::vector<std::unique_ptr<RenderTarget>> m_levels; // Largest first
+
+    GLuint m_emptyVAO = 0; // The fullscreen triangle has no attributes
+
+    float m_threshold = 0.6f; // Brightness where glow starts
+    float m_intensity = 0.8f; // Bloom added onto the scene
+
+    /**
+     * @brief Sizes the level chain for the tier and the scene (no-op if unchanged).
+     */
+    void resizeLevels(GLsizei sceneWidth, GLsizei sceneHeight);
+
+    /**
+     * @brief Renders from source (sampled on unit 0) into target.
+     */
+    void blit(const Shader& shader, UniformVec2 halfPixel, GLuint source, const RenderTarget& target) const;
+
+public:
+    BloomPass(); // Needs a current GL context (compiles the shaders)
+    ~BloomPass();
+
+    BloomPass(const BloomPass&) = delete;
+    BloomPass& operator=(const BloomPass&) = delete;
+
+    void setQuality(BloomQuality quality) { m_quality = quality; }
+    BloomQuality getQuality() const { return m_quality; }
+    bool isEnabled() const { return m_quality != BloomQuality::OFF; }
+
+    /**
+     * @brief Blurs the bright parts of scene and draws scene + bloom into the
+     * window's framebuffer (outputWidth x outputHeight, bilinear if the sizes
+     * differ). Changes the blend state; the scene's must be set again afterwards.
+     */
+    void Execute(GpuTimer& timer, const RenderTarget& scene, GLsizei outputWidth, GLsizei outputHeight);
+};
+
+} // namespace EchoDrift::Rendering
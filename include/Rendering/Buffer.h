@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Rendering/GLCommon.h"
+#include "Rendering/GLStateCache.h"
 #include <vector>
 
 namespace EchoDrift::Rendering {
@@ -28,14 +29,14 @@ public:
      * @brief Binds the VAO, making it the active context for drawing.
      */
     void Bind() const {
-        glBindVertexArray(m_VAO);
+        GLStateCache::GetInstance().BindVertexArray(m_VAO);
     }
 
     /**
      * @brief Unbinds the VAO.
      */
     void Unbind() const {
-        glBindVertexArray(0);
+        GLStateCache::GetInstance().BindVertexArray(0);
     }
     
     /**
@@ -45,6 +46,7 @@ public:
      */
     void SetData(const std::vector<float>& vertices);
     
+    GLuint getVertexArrayID() const { return m_VAO; }
     GLsizei getVertexCount() const { return m_vertexCount; }
 };
 
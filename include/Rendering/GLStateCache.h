@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Rendering/GLCommon.h"
+#include <cstdint>
+
+namespace EchoDrift::Rendering {
+
+/**
+ * @class GLStateCache
+ * @brief Shadow copy of the GL binding/blend state, so redundant state calls are skipped.
+ *
+ * Every wrapper (Shader::Use, Buffer::Bind, the batches, the Renderer) changes
+ * program, VAO, buffer bindings, blending and line width through here. A call
+ * that would set what is already set is dropped and counted, which makes the
+ * savings visible in profiles (getSkippedCalls / getIssuedCalls).
+ *
+ * The cache is only correct if nothing binds behind its back. Code that does
+ * raw GL (or a library that does) must call Invalidate() afterwards. Objects
+ * are deleted through it as well (DeleteBuffer etc.), because GL reuses names
+ * and an old "still bound" entry would skip a needed bind.
+ */
+class GLStateCache {
+public:
+    static GLStateCache& GetInstance();
+
+    // --- Bindings ---
+    void UseProgram(GLuint program);
+    void BindVertexArray(GLuint vertexArray);
+
+    /**
+     * @brief Tracked targets: GL_ARRAY_BUFFER, GL_COPY_READ_BUFFER,
+     * GL_COPY_WRITE_BUFFER, GL_UNIFORM_BUFFER. Other targets pass straight through.
+     * (GL_ELEMENT_ARRAY_BUFFER is VAO state and deliberately not cached.)
+     */
+    void BindBuffer(GLenum target, GLuint buffer);
+
+    // --- Fixed-function state ---
+    void SetBlend(bool enabled);
+    void BlendFunc(GLenum sourceFactor, GLenum destFactor);
+    void LineWidth(float width);
+
+    // --- Object lifetime (delete through here so stale bindings are forgotten) ---
+    void DeleteProgram(GLuint program);
+    void DeleteVertexArray(GLuint vertexArray);
+    void DeleteBuffer(GLuint buffer);
+
+    /**
+     * @brief Forgets everything; the next call of each kind is always issued.
+     */
+    void Invalidate();
+
+    // --- Counters (for profiling) ---
+    std::uint64_t getIssuedCalls() const { return m_issuedCalls; }
+    std::uint64_t getSkippedCalls() const { return m_skippedCalls; }
+    void ResetCounters() { m_issuedCalls = 0; m_skippedCalls = 0; }
+
+private:
+    GLStateCache() { Invalidate(); }
+    GLStateCache(const GLStateCache&) = delete;
+    GLStateCache& operator=(const GLStateCache&) = delete;
+
+    // Not a name GL hands out in practice; marks "unknown, always issue".
+    static constexpr GLuint UNKNOWN = 0xFFFFFFFFu;
+
+    enum BufferSlot { ARRAY, COPY_READ, COPY_WRITE, UNIFORM, BUFFER_SLOT_COUNT };
+    static int slotFor(GLenum target);
+
+    GLuint m_program;
+    GLuint m_vertexArray;
+    GLuint m_buffers[BUFFER_SLOT_COUNT];
+
+    int m_blendEnabled;  // -1 = unknown
+    GLenum m_blendSource;
+    GLenum m_blendDest;
+    bool m_blendFuncKnown;
+    float m_lineWidth;
+    bool m_lineWidthKnown;
+
+    std::uint64_t m_issuedCalls = 0;
+    std::uint64_t m_skippedCalls = 0;
+
+    // Returns true (and counts) when the call has to go to GL.
+    bool issue(bool changed) {
+        if (changed) ++m_issuedCalls; else ++m_skippedCalls;
+        return changed;
+    }
+};
+
+} // namespace EchoDrift::Rendering
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Rendering/GLCommon.h"
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace EchoDrift::Rendering {
+
+/**
+ * @class GpuTimer
+ * @brief Measures GPU time per named pass with GL_TIME_ELAPSED queries, without stalling.
+ *
+ * Each frame gets its own slot of query objects in a ring FRAME_LATENCY deep.
+ * A slot is only read back once GL_QUERY_RESULT_AVAILABLE is set for all of
+ * its queries; results therefore arrive a frame or two late, and if the GPU
+ * falls a full ring behind, that frame's timings are dropped rather than waited for.
+ *
+ * Passes cannot nest (one GL_TIME_ELAPSED query may be active at a time):
+ * BeginPass() closes the open pass first.
+ *
+ * Begin/End calls belong to the GL thread; getLatest() may be called from any
+ * thread (HUD, trace exporters).
+ */
+class GpuTimer {
+public:
+    static constexpr int FRAME_LATENCY = 4; // Frames of queries in flight
+    static constexpr int MAX_PASSES = 16;   // Per frame
+
+    struct PassTiming {
+        const char* name; // Static string passed to BeginPass
+        double milliseconds;
+    };
+
+    struct FrameTimings {
+        std::uint64_t frame = 0;          // Frame number the timings belong to
+        std::vector<PassTiming> passes;   // In execution order
+        double totalMilliseconds = 0.0;
+    };
+
+    GpuTimer();
+    ~GpuTimer();
+
+    GpuTimer(const GpuTimer&) = delete;
+    GpuTimer& operator=(const GpuTimer&) = delete;
+
+    /**
+     * @brief Publishes every finished frame and claims the next slot of the ring.
+     */
+    void BeginFrame();
+
+    /**
+     * @brief Starts timing a pass (name must outlive the results, e.g. a literal).
+     */
+    void BeginPass(const char* name);
+    void EndPass();
+
+    void EndFrame();
+
+    /**
+     * @brief Most recent frame whose queries have all completed (thread-safe copy).
+     */
+    FrameTimings getLatest() const;
+
+private:
+    struct Slot {
+        GLuint queries[MAX_PASSES] = {};
+        const char* names[MAX_PASSES] = {};
+        int passCount = 0;
+        std::uint64_t frame = 0;
+        bool pending = false; // Issued, not read back yet
+    };
+
+    Slot m_slots[FRAME_LATENCY];
+    int m_current = 0;          // Slot being recorded
+    bool m_passOpen = false;
+    std::uint64_t m_frameCounter = 0;
+
+    /**
+     * @brief Reads the slot back if all of its results are available. Never blocks.
+     */
+    bool tryCollect(Slot& slot);
+
+    mutable std::mutex m_resultsMutex;
+    FrameTimings m_latest;
+};
+
+} // namespace EchoDrift::Rendering
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Rendering/GLCommon.h"
+#include <cstdint>
+#include <string>
+
+namespace EchoDrift::Rendering {
+
+/**
+ * @class ProgramBinaryCache
+ * @brief Keeps linked shader programs on disk (glGetProgramBinary) so later
+ * launches skip GLSL compilation and linking (glProgramBinary).
+ *
+ * A program is keyed by a hash of both sources (with their defines applied)
+ * and the driver's vendor, renderer and version strings: a driver update or
+ * a different GPU simply misses the cache. A binary the driver still rejects
+ * (GL_LINK_STATUS false after glProgramBinary) is deleted, and the caller
+ * compiles from source as if there had been no cache entry.
+ *
+ * Needs GL 4.1 or ARB_get_program_binary, and a driver that reports at least
+ * one binary format; otherwise every lookup misses and nothing is written.
+ */
+class ProgramBinaryCache {
+public:
+    static ProgramBinaryCache& GetInstance();
+
+    /**
+     * @brief Directory the binaries are written to (default "shader_cache").
+     */
+    void setDirectory(const std::string& directory) { m_directory = directory; }
+
+    /**
+     * @brief Cache key for a program built from these (define-expanded) sources.
+     * Needs a current GL context (reads the driver strings).
+     */
+    std::uint64_t MakeKey(const std::string& vertexSource, const std::string& fragmentSource);
+
+    /**
+     * @brief A linked program created from the cached binary, or 0 on a miss
+     * (no entry, unsupported, or rejected by the driver).
+     */
+    GLuint Load(std::uint64_t key);
+
+    /**
+     * @brief Writes the program's binary under key. The program should have
+     * been linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT (see PrepareForLink).
+     */
+    void Store(std::uint64_t key, GLuint program);
+
+    /**
+     * @brief Call between creating a program and glLinkProgram.
+     */
+    void PrepareForLink(GLuint program);
+
+    bool isSupported();
+
+private:
+    ProgramBinaryCache() = default;
+    ProgramBinaryCache(const ProgramBinaryCache&) = delete;
+    ProgramBinaryCache& operator=(const ProgramBinaryCache&) = delete;
+
+    std::string pathFor(std::uint64_t key) const;
+
+    std::string m_directory = "shader_cache";
+    std::string m_driver;   // Vendor, renderer and version, read once
+    int m_supported = -1;   // -1 = not checked yet
+};
+
+} // namespace EchoDrift::Rendering
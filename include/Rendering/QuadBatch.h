@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Rendering/GLCommon.h"
+#include "Rendering/StreamBuffer.h"
+#include <vector>
+
+namespace EchoDrift::Rendering {
+
+/**
+ * @brief Per-instance data for one quad: center in grid cells (fractional for
+ * interpolated movement), RGBA8 color, and edge length in cells. 16 bytes.
+ */
+struct QuadInstance {
+    float center[2];
+    GLubyte color[4];
+    float size;
+};
+
+/**
+ * @class QuadBatch
+ * @brief Instanced renderer for entity heads, pickups and markers.
+ *
+ * A static unit quad (4 vertices, uploaded once) is combined with a
+ * per-instance stream of QuadInstance. Add() only appends to a CPU array on
+ * the game thread; TakeInstances() hands the frame's array over, and Draw()
+ * (GL thread) copies it into a StreamBuffer region (persistent-mapped and
+ * fenced per frame in flight, orphaned only where that is unavailable) and
+ * draws them all with one glDrawArraysInstanced. No GL objects are created or
+ * deleted per frame.
+ */
+class QuadBatch {
+private:
+    GLuint m_VAO = 0;
+    GLuint m_quadVBO = 0;     // Static unit quad (triangle strip)
+    StreamBuffer m_instanceStream; // QuadInstance ring, one region per frame in flight
+
+    std::vector<QuadInstance> m_instances; // This frame's quads
+
+    void setupAttributes() const;
+
+    /**
+     * @brief Points the per-instance attributes at offset in the stream buffer.
+     */
+    void bindInstances(GLintptr offset) const;
+
+public:
+    QuadBatch();
+    ~QuadBatch();
+
+    QuadBatch(const QuadBatch&) = delete;
+    QuadBatch& operator=(const QuadBatch&) = delete;
+
+    /**
+     * @brief Queues a quad for this frame.
+     * @param x,y Center in grid cells.
+     * @param size Edge length in cells.
+     * @param r,g,b Color, 0..1.
+     */
+    void Add(float x, float y, float size, float r, float g, float b);
+
+    /**
+     * @brief Moves this frame's queued quads into instances (the queue is left empty).
+     */
+    void TakeInstances(std::vector<QuadInstance>& instances);
+
+    /**
+     * @brief Uploads and draws the instances in one instanced call (GL thread).
+     * The caller must have the quad shader in use.
+     */
+    void Draw(const std::vector<QuadInstance>& instances);
+
+    /**
+     * @brief Fences this frame's instance region (GL thread, after the frame's draws).
+     */
+    void EndFrame() { m_instanceStream.EndFrame(); }
+
+    GLsizei getQueuedCount() const { return static_cast<GLsizei>(m_instances.size()); }
+};
+
+} // namespace EchoDrift::Rendering
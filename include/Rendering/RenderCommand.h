@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Rendering/GLCommon.h"
+#include "Rendering/TrailBatch.h"
+#include "Rendering/QuadBatch.h"
+#include "Rendering/BloomPass.h"
+#include <cstdint>
+#include <vector>
+
+namespace EchoDrift::Rendering {
+
+class Shader;
+class Buffer;
+
+/**
+ * @enum RenderPass
+ * @brief Coarsest part of the sort key: passes always execute in this order.
+ */
+enum class RenderPass : std::uint8_t {
+    BACKGROUND = 0, // Clear, grid
+    WORLD = 1,      // Trails and other world geometry
+    OVERLAY = 2,    // Heads, markers
+    HUD = 3         // Drawn after post-processing, always at native resolution
+};
+
+/**
+ * @brief Packs a 64-bit sort key, most significant field first:
+ * [63..56] pass | [55..40] shader | [39..16] buffer | [15..0] depth.
+ * Sorting by it groups draws by program, then by VAO, so the state cache
+ * can skip most of the binds between consecutive commands.
+ */
+constexpr std::uint64_t MakeSortKey(RenderPass pass, std::uint32_t shader, std::uint32_t buffer, std::uint16_t depth) {
+    return (static_cast<std::uint64_t>(pass) << 56) |
+           (static_cast<std::uint64_t>(shader & 0xFFFFu) << 40) |
+           (static_cast<std::uint64_t>(buffer & 0xFFFFFFu) << 16) |
+           static_cast<std::uint64_t>(depth);
+}
+
+enum class RenderCommandType : std::uint8_t {
+    CLEAR,       // Clear the color buffer
+    DRAW_ARRAYS, // glDrawArrays from a Buffer with a Shader and a color
+    DRAW_TRAILS, // The frame's TrailFrame (one multi-draw)
+    DRAW_QUADS,  // The frame's quad instances (one instanced draw)
+    DRAW_FULLSCREEN // One attribute-less triangle covering the viewport with a Shader and a color
+};
+
+/**
+ * @brief One recorded draw. Plain data; recording allocates nothing
+ * once the frame's command vector has grown to its working size.
+ */
+struct RenderCommand {
+    std::uint64_t key = 0;
+    RenderCommandType type = RenderCommandType::CLEAR;
+    GLenum primitiveType = GL_TRIANGLES;
+    const Shader* shader = nullptr;
+    const Buffer* buffer = nullptr;
+    GLint first = 0;
+    GLsizei count = 0;
+    float color[3] = {0.0f, 0.0f, 0.0f};
+};
+
+/**
+ * @brief Everything one frame needs on the GL thread: the unsorted command
+ * list plus the batched per-frame data the commands refer to.
+ */
+struct RenderFrame {
+    std::vector<RenderCommand> commands;
+    TrailFrame trails;
+    std::vector<QuadInstance> quads;
+    GLFWwindow* window = nullptr; // Swapped after execution (nullptr = no present)
+    int width = 0;                // Window framebuffer size in pixels
+    int height = 0;
+    BloomQuality bloomQuality = BloomQuality::MEDIUM;
+    float renderScale = 1.0f;     // Scene resolution per axis (dynamic resolution)
+    std::uint32_t tick = 0;       // Simulation tick (low 32 bits) the trails age against
+    float tickAlpha = 0.0f;       // Fraction of the next tick already elapsed
+
+    void Clear() {
+        commands.clear();
+        trails.Clear();
+        quads.clear();
+        window = nullptr;
+    }
+};
+
+} // namespace EchoDrift::Rendering
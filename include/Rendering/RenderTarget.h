@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Rendering/GLCommon.h"
+
+namespace EchoDrift::Rendering {
+
+/**
+ * @class RenderTarget
+ * @brief An offscreen framebuffer with one color texture (bilinear, clamped).
+ *
+ * Nothing is created until the first Resize(), which must happen on the GL
+ * thread; resizing to the current size is free, so callers can simply
+ * Resize() every frame to follow the window.
+ */
+class RenderTarget {
+private:
+    GLuint m_FBO = 0;
+    GLuint m_texture = 0;
+    GLenum m_internalFormat = GL_RGBA16F;
+    GLsizei m_width = 0;
+    GLsizei m_height = 0;
+
+public:
+    explicit RenderTarget(GLenum internalFormat = GL_RGBA16F) : m_internalFormat(internalFormat) {}
+    ~RenderTarget();
+
+    RenderTarget(const RenderTarget&) = delete;
+    RenderTarget& operator=(const RenderTarget&) = delete;
+
+    /**
+     * @brief (Re)allocates the color texture if the size changed (contents are then undefined).
+     */
+    void Resize(GLsizei width, GLsizei height);
+
+    /**
+     * @brief Deletes the framebuffer and texture (GL thread); the next Resize() recreates them.
+     */
+    void Release();
+
+    /**
+     * @brief Binds the framebuffer for drawing and sets the viewport to cover it.
+     */
+    void Bind() const;
+
+    /**
+     * @brief Binds the window's framebuffer with a viewport of width x height.
+     */
+    static void BindDefault(GLsizei width, GLsizei height);
+
+    GLuint getTexture() const { return m_texture; }
+    GLsizei getWidth() const { return m_width; }
+    GLsizei getHeight() const { return m_height; }
+};
+
+} // namespace EchoDrift::Rendering
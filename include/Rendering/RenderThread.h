@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Rendering/GLCommon.h"
+#include "Rendering/RenderCommand.h"
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace EchoDrift::Rendering {
+
+/**
+ * @class RenderThread
+ * @brief Dedicated thread that owns the GL context and executes recorded frames.
+ *
+ * The game thread records frame N+1 while this thread executes frame N. Two
+ * RenderFrame objects circulate between them: Submit() hands over the recorded
+ * one and gets the previously executed one back, cleared, to record into.
+ * Submit() only blocks if the GPU side is still busy with the frame before.
+ */
+class RenderThread {
+public:
+    using ExecuteFunction = std::function<void(RenderFrame&)>;
+
+    RenderThread() = default;
+    ~RenderThread() { Stop(); }
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    /**
+     * @brief Releases the context on the calling thread and starts executing on a new one.
+     */
+    void Start(GLFWwindow* window, ExecuteFunction execute);
+
+    /**
+     * @brief Queues a recorded frame; returns an empty frame for recording the next one.
+     */
+    std::unique_ptr<RenderFrame> Submit(std::unique_ptr<RenderFrame> frame);
+
+    /**
+     * @brief Finishes the queued frame, joins, and makes the context current on the caller again.
+     */
+    void Stop();
+
+    bool isRunning() const { return m_thread.joinable(); }
+
+private:
+    void run();
+
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+
+    std::unique_ptr<RenderFrame> m_pending; // Submitted, not yet picked up
+    std::unique_ptr<RenderFrame> m_spare;   // Executed, ready to be recorded into again
+    bool m_busy = false;                    // A frame is executing right now
+    bool m_quit = false;
+
+    GLFWwindow* m_window = nullptr;
+    ExecuteFunction m_execute;
+};
+
+} // namespace EchoDrift::Rendering
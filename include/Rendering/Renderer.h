@@ -3,6 +3,19 @@
 // We include necessary GL headers here, NOT in GameManager.h.
 #include "Rendering/GLCommon.h"
 #include "Shader.h" // Need the Shader class definition
+#include "Rendering/Buffer.h"
+#include "Rendering/TrailBatch.h"
+#include "Rendering/QuadBatch.h"
+#include "Rendering/RenderCommand.h"
+#include "Rendering/RenderThread.h"
+#include "Rendering/GpuTimer.h"
+#include "Rendering/BloomPass.h"
+#include "Rendering/RenderTarget.h"
+#include "Rendering/ResolutionScaler.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
 
 namespace EchoDrift::Rendering {
 
@@ -10,15 +23,92 @@ namespace EchoDrift::Rendering {
  * @class Renderer
  * @brief Handles all low-level OpenGL commands. 
  * Abstracts graphics details away from the core game logic.
+ *
+ * Draw calls made during a frame are only recorded (RenderCommand with a sort
+ * key); EndFrame() sorts and executes them, either right away or, after
+ * StartRenderThread(), on a dedicated thread that owns the GL context while
+ * the game thread moves on to the next frame. Once the thread runs, the game
+ * thread must not make GL calls: Init/setGridSize and GL object creation
+ * belong before StartRenderThread().
  */
 class Renderer {
 private:
     // Composition: The Renderer owns the shader program it needs.
     std::unique_ptr<Shader> m_defaultShader;
 
+    // Trails: ribbons expanded from the grid-cell vertices in the vertex shader.
+    std::unique_ptr<Shader> m_trailShader;
+
+    // Every entity's trail, in one VBO, drawn with one multi-draw per frame.
+    std::unique_ptr<TrailBatch> m_trailBatch;
+
+    // Trail age clock: fade and pulse are computed per pixel from the tick
+    // stored in each vertex, so animating them rewrites no vertices.
+    UniformUint m_trailCurrentTick;
+    UniformFloat m_trailTickAlpha;
+
+    // Ribbon antialiasing pads each quad by a pixel, so the trail shader needs
+    // the pixel size in cells of whatever target the scene is drawn into.
+    UniformVec2 m_trailPixelSize;
+    int m_gridWidth = 1;  // Cells; set with setGridSize before the render thread starts
+    int m_gridHeight = 1;
+
+    // Procedural grid: lines computed per pixel over a fullscreen triangle.
+    std::unique_ptr<Shader> m_gridShader;
+
+    // Core profile needs a VAO bound even for draws that fetch no attributes.
+    GLuint m_emptyVAO = 0;
+
+    // Heads, pickups and markers: instanced unit quads placed in grid cells.
+    std::unique_ptr<Shader> m_quadShader;
+    std::unique_ptr<QuadBatch> m_quadBatch;
+
+    // GPU time per pass, read back without stalling.
+    std::unique_ptr<GpuTimer> m_gpuTimer;
+
+    // The glow: the scene is drawn into an HDR target, bloomed and composited.
+    std::unique_ptr<BloomPass> m_bloom;
+    RenderTarget m_sceneTarget{GL_RGBA16F};
+    BloomQuality m_bloomQuality = BloomQuality::MEDIUM; // Game thread; travels with each frame
+
+    // Dynamic resolution: the scene target shrinks when the GPU falls behind
+    // and is upscaled into the window (the HUD pass stays native).
+    ResolutionScaler m_resolutionScaler;                // Game thread
+    std::unique_ptr<Shader> m_upscaleShader;            // Used when bloom is off
+    std::uint64_t m_lastGpuFrame = 0;                   // Last GPU timing fed to the scaler
+    std::chrono::steady_clock::time_point m_frameStart; // Game thread work starts here
+    bool m_frameStarted = false;
+    std::atomic<double> m_executeMilliseconds{0.0};     // CPU time of the last executeFrame
+
+    /**
+     * @brief Feeds the scaler this frame's CPU time and the newest GPU time (game thread).
+     */
+    void updateRenderScale();
+
+    /**
+     * @brief Draws the offscreen scene into the window: bloom composite or plain upscale.
+     */
+    void resolveScene(const RenderFrame& frame);
+
+    // The frame being recorded on the game thread.
+    std::unique_ptr<RenderFrame> m_recording;
+
+    // Executes recorded frames when started; otherwise EndFrame executes inline.
+    RenderThread m_renderThread;
+
+    /**
+     * @brief Uploads batched data, sorts the commands and runs them (GL thread).
+     */
+    void executeFrame(RenderFrame& frame);
+
+    // Fraction (0..1) of the way from the last simulation tick to the next,
+    // set by the GameManager each frame.
+    float m_interpolationAlpha = 0.0f;
+    std::uint64_t m_currentTick = 0;
+
 public:
     Renderer() = default;
-    ~Renderer() = default;
+    ~Renderer();
 
     /**
      * @brief Initializes any necessary OpenGL state.
@@ -36,6 +126,94 @@ public:
      */
     void DrawObject(float r, float g, float b); 
 
-    void Draw(const Buffer& buffer, const Shader& shader, float r, float g, float b, GLenum primitiveType) const;};
+    /**
+     * @brief Records a draw of the buffer's live vertices.
+     * The buffer and shader must stay alive until the next EndFrame() has returned.
+     * @param pass/depth Sort order (passes first, depth within the same program and VAO).
+     */
+    void Draw(const Buffer& buffer, const Shader& shader, float r, float g, float b, GLenum primitiveType,
+              RenderPass pass = RenderPass::WORLD, std::uint16_t depth = 0);
+
+    /**
+     * @brief Records one fullscreen triangle drawn with shader (its vertex
+     * shader must build the triangle from gl_VertexID).
+     */
+    void DrawFullscreen(const Shader& shader, float r, float g, float b,
+                        RenderPass pass = RenderPass::BACKGROUND, std::uint16_t depth = 0);
+
+    /**
+     * @brief Records the draw of every trail submitted this frame (one glMultiDrawArrays).
+     */
+    void DrawTrails();
+
+    /**
+     * @brief Records the draw of every quad queued this frame (one glDrawArraysInstanced).
+     */
+    void DrawQuads();
+
+    /**
+     * @brief Ends recording: executes the frame (or hands it to the render
+     * thread) and presents it to window.
+     */
+    void EndFrame(GLFWwindow* window);
+
+    /**
+     * @brief Moves GL execution to a dedicated thread (the context moves with it).
+     */
+    void StartRenderThread(GLFWwindow* window);
+
+    /**
+     * @brief Joins the render thread and makes the context current on the caller again.
+     */
+    void StopRenderThread();
+
+    /**
+     * @brief Stops the render thread and deletes every GL object the renderer
+     * owns, while the context still exists. Safe to call more than once.
+     * Anything holding a trail range (TrailMesh) must be destroyed first.
+     */
+    void Shutdown();
+
+    TrailBatch& getTrailBatch() { return *m_trailBatch; }
+    QuadBatch& getQuadBatch() { return *m_quadBatch; }
+    const Shader* getDefaultShader() const { return m_defaultShader.get(); }
+    const Shader* getTrailShader() const { return m_trailShader.get(); }
+    const Shader* getGridShader() const { return m_gridShader.get(); }
+
+    /**
+     * @brief Tells the grid-space shaders (grid, trails, quads) the grid dimensions for their NDC mapping.
+     */
+    void setGridSize(int width, int height);
+
+    /**
+     * @brief GPU milliseconds per pass of the most recent completed frame
+     * (a frame or two behind; safe to call from the game thread).
+     */
+    GpuTimer::FrameTimings getGpuTimings() const { return m_gpuTimer->getLatest(); }
+
+    /**
+     * @brief Selects the bloom tier from the next frame on (OFF draws straight to the window).
+     */
+    void setBloomQuality(BloomQuality quality) { m_bloomQuality = quality; }
+    BloomQuality getBloomQuality() const { return m_bloomQuality; }
+
+    /**
+     * @brief Enables/configures dynamic resolution (scale range and target frame time).
+     */
+    void setDynamicResolution(const DynamicResolutionSettings& settings) { m_resolutionScaler.Configure(settings); }
+
+    /**
+     * @brief Current scene resolution per axis (1 = native).
+     */
+    float getRenderScale() const { return m_resolutionScaler.getScale(); }
+
+    void setInterpolationAlpha(float alpha) { m_interpolationAlpha = alpha; }
+    float getInterpolationAlpha() const { return m_interpolationAlpha; }
+
+    /**
+     * @brief The simulation tick the trail vertices' ticks are aged against this frame.
+     */
+    void setCurrentTick(std::uint64_t tick) { m_currentTick = tick; }
+};
 
 } // namespace EchoDrift::Rendering
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+
+namespace EchoDrift::Rendering {
+
+/**
+ * @brief Configuration of dynamic resolution (scales are per axis, 1 = native).
+ */
+struct DynamicResolutionSettings {
+    bool enabled = true;
+    float minScale = 0.5f;
+    float maxScale = 1.0f;
+    double targetFrameMilliseconds = 1000.0 / 60.0;
+};
+
+/**
+ * @class ResolutionScaler
+ * @brief Picks the scene's render scale from smoothed GPU and CPU frame times.
+ *
+ * GPU time is what resolution changes; it is steered towards a budget that is
+ * the target frame time, or the CPU frame time when the CPU is slower anyway
+ * (a lower resolution would not make such a frame any faster). Pixel cost goes
+ * with the square of the scale, so the correction is the square root of the
+ * budget ratio. The scale moves in fixed steps, changes at most once per
+ * cooldown, and has a dead band below the budget: render targets are
+ * reallocated on every change, so it must not oscillate.
+ *
+ * Plain arithmetic, no GL: runs on the game thread.
+ */
+class ResolutionScaler {
+public:
+    static constexpr float SCALE_STEP = 0.05f;    // Granularity of scale changes
+    static constexpr long MAX_STEPS_DOWN = 4;     // Per change
+    static constexpr int COOLDOWN_SAMPLES = 15;   // GPU samples between changes
+    static constexpr double SMOOTHING = 0.1;      // Weight of a new sample (EMA)
+    static constexpr double HEADROOM = 0.9;       // Aim below the budget...
+    static constexpr double GROW_BELOW = 0.7;     // ...and only grow well below it
+
+    void Configure(const DynamicResolutionSettings& settings);
+    const DynamicResolutionSettings& getSettings() const { return m_settings; }
+
+    /**
+     * @brief Feeds one frame's CPU time (milliseconds, every frame).
+     */
+    void AddCpuSample(double milliseconds);
+
+    /**
+     * @brief Feeds one frame's GPU time and updates the scale. Call once per
+     * completed GPU frame (results are a few frames late; feed each frame once).
+     */
+    void AddGpuSample(double milliseconds);
+
+    float getScale() const { return m_settings.enabled ? m_scale : 1.0f; }
+    double getSmoothedGpuMilliseconds() const { return m_gpuMilliseconds; }
+    double getSmoothedCpuMilliseconds() const { return m_cpuMilliseconds; }
+
+private:
+    DynamicResolutionSettings m_settings;
+    float m_scale = 1.0f;
+    double m_gpuMilliseconds = 0.0;
+    double m_cpuMilliseconds = 0.0;
+    bool m_hasGpuSample = false;
+    bool m_hasCpuSample = false;
+    int m_cooldown = 0;
+};
+
+} // namespace EchoDrift::Rendering
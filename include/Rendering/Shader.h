@@ -1,11 +1,37 @@
 #pragma once
 
 #include "Rendering/GLCommon.h"
+#include "Rendering/GLStateCache.h"
 #include <string>
 #include <iostream>
+#include <unordered_map>
+#include <vector>
+#include <array>
 
 namespace EchoDrift::Rendering {
 
+/**
+ * @brief Typed handle to one reflected uniform of a Shader.
+ * Resolve it once (Shader::getUniformVec3 etc.) and reuse it every draw:
+ * no string lookups or glGetUniformLocation calls on the hot path.
+ * An invalid handle (unknown or optimised-out uniform) makes the setter a no-op.
+ */
+template <GLenum GLType>
+struct UniformHandle {
+    GLint location = -1;
+    int slot = -1; // Index into the owning shader's last-value cache
+
+    bool isValid() const { return location >= 0; }
+};
+
+using UniformInt   = UniformHandle<GL_INT>; // Also accepts sampler uniforms
+using UniformUint  = UniformHandle<GL_UNSIGNED_INT>;
+using UniformFloat = UniformHandle<GL_FLOAT>;
+using UniformVec2  = UniformHandle<GL_FLOAT_VEC2>;
+using UniformVec3  = UniformHandle<GL_FLOAT_VEC3>;
+using UniformVec4  = UniformHandle<GL_FLOAT_VEC4>;
+using UniformMat4  = UniformHandle<GL_FLOAT_MAT4>;
+
 /**
  * @class Shader
  * @brief Encapsulates OpenGL shader program creation, compilation, and usage.
@@ -15,19 +41,60 @@ private:
     // The OpenGL ID for the compiled and linked shader program.
     GLuint m_programID;
 
+    // Active uniforms, enumerated once after linking (arrays under their bare name).
+    struct UniformInfo {
+        GLint location;
+        GLenum type;
+        GLint arraySize;
+        int slot;
+    };
+    std::unordered_map<std::string, UniformInfo> m_uniforms;
+
+    // Last value uploaded per uniform (large enough for a mat4), so setting
+    // the same value again skips the glUniform call. Uniforms are program
+    // state, so the cache stays valid across Use() switches.
+    struct CachedValue {
+        std::array<GLfloat, 16> data{};
+        bool valid = false;
+    };
+    mutable std::vector<CachedValue> m_lastValues;
+
+    // "uColor" is set on every draw by the Renderer, so it is resolved up front.
+    UniformVec3 m_colorUniform;
+
     // --- Helper Methods (Encapsulated Low-Level Logic) ---
+    std::string loadShaderSource(const std::string& name) const; // Embedded, or from disk (dev override)
     std::string readShaderFile(const std::string& filePath) const;
+    static std::string applyDefines(const std::string& source, const std::vector<std::string>& defines);
+    GLuint linkFromSource(const std::string& vertexSource, const std::string& fragmentSource) const;
     GLuint compileShader(GLuint type, const std::string& source) const;
     void checkCompileErrors(GLuint shader, const std::string& type) const;
     void checkLinkErrors(GLuint program) const;
+    void reflectUniforms();
+    const UniformInfo* findUniform(const std::string& name, GLenum expectedType) const;
+    bool storeIfChanged(int slot, const void* value, std::size_t bytes) const;
+
+    template <GLenum GLType>
+    UniformHandle<GLType> resolveUniform(const std::string& name) const {
+        UniformHandle<GLType> handle;
+        if (const UniformInfo* info = findUniform(name, GLType)) {
+            handle.location = info->location;
+            handle.slot = info->slot;
+        }
+        return handle;
+    }
 
 public:
     /**
-     * @brief Loads, compiles, and links the vertex and fragment shaders.
-     * @param vertexPath File path to the vertex shader (.vert).
-     * @param fragmentPath File path to the fragment shader (.frag).
+     * @brief Loads, compiles, and links the vertex and fragment shaders
+     * (or loads the linked program from the ProgramBinaryCache).
+     * @param vertexPath Name of the vertex shader inside shaders/ (.vert).
+     * @param fragmentPath Name of the fragment shader inside shaders/ (.frag).
+     * @param defines Inserted as "#define <entry>" after each #version line
+     * (e.g. "BLOOM_TAPS 8").
      */
-    Shader(const std::string& vertexPath, const std::string& fragmentPath);
+    Shader(const std::string& vertexPath, const std::string& fragmentPath,
+           const std::vector<std::string>& defines = {});
     
     // RAII: Clean up the program when the object goes out of scope.
     ~Shader(); 
@@ -35,16 +102,50 @@ public:
     // --- Abstraction Methods (The Interface) ---
     
     /**
-     * @brief Activates the shader program for rendering.
+     * @brief Activates the shader program for rendering (skipped if already active).
      */
-    void Use() const { glUseProgram(m_programID); }
-    
+    void Use() const { GLStateCache::GetInstance().UseProgram(m_programID); }
+
+    GLuint getProgramID() const { return m_programID; }
+
+    // --- Uniform Handles (resolve once, e.g. at init) ---
+    // Unknown names and type mismatches return an invalid handle and log a warning.
+
+    UniformInt getUniformInt(const std::string& name) const { return resolveUniform<GL_INT>(name); }
+    UniformUint getUniformUint(const std::string& name) const { return resolveUniform<GL_UNSIGNED_INT>(name); }
+    UniformFloat getUniformFloat(const std::string& name) const { return resolveUniform<GL_FLOAT>(name); }
+    UniformVec2 getUniformVec2(const std::string& name) const { return resolveUniform<GL_FLOAT_VEC2>(name); }
+    UniformVec3 getUniformVec3(const std::string& name) const { return resolveUniform<GL_FLOAT_VEC3>(name); }
+    UniformVec4 getUniformVec4(const std::string& name) const { return resolveUniform<GL_FLOAT_VEC4>(name); }
+    UniformMat4 getUniformMat4(const std::string& name) const { return resolveUniform<GL_FLOAT_MAT4>(name); }
+
+    /**
+     * @brief Handle to the "uColor" vec3 (invalid if the program has none).
+     */
+    UniformVec3 getColorUniform() const { return m_colorUniform; }
+
+    /**
+     * @brief Uploads a uniform value unless it equals the last one uploaded.
+     * The program must be in use (Use()) when a changed value is set.
+     */
+    void setUniform(UniformInt uniform, GLint value) const;
+    void setUniform(UniformUint uniform, GLuint value) const;
+    void setUniform(UniformFloat uniform, float value) const;
+    void setUniform(UniformVec2 uniform, float x, float y) const;
+    void setUniform(UniformVec3 uniform, float x, float y, float z) const;
+    void setUniform(UniformVec4 uniform, float x, float y, float z, float w) const;
+    void setUniform(UniformMat4 uniform, const GLfloat* columnMajor) const;
+
     /**
      * @brief Sets a uniform (constant) float value in the shader.
+     * Convenience for cold paths: looks the name up each call. Prefer a handle per frame.
      */
     void setUniformFloat(const std::string& name, float value) const;
     
-    // TODO: Add setUniformVec2, setUniformMat4, etc., as needed.
+    /**
+     * @brief Sets a uniform vec2 value in the shader (program must be in use).
+     */
+    void setUniformVec2(const std::string& name, float x, float y) const;
 };
 
 } // namespace EchoDrift::Rendering
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Rendering/GLCommon.h"
+#include "Rendering/GLStateCache.h"
+
+namespace EchoDrift::Rendering {
+
+/**
+ * @class StreamBuffer
+ * @brief Ring buffer for transient per-frame GPU data (quad instances, markers, debug lines).
+ *
+ * On GL 4.4 / ARB_buffer_storage the VBO is allocated with glBufferStorage
+ * and kept persistently and coherently mapped. It is split into three regions,
+ * one per frame in flight, each guarded by a glFenceSync, so the CPU writes
+ * straight into GPU-visible memory and only waits if it gets three frames ahead.
+ *
+ * On plain GL 3.3, or if the persistent map fails, it falls back to orphaning:
+ * the buffer is re-specified with glBufferData(nullptr) each frame and written
+ * through unsynchronized maps.
+ *
+ * The buffer holds raw bytes; the caller points its own VAO's attributes at
+ * getBuffer() + the offset Allocate() returns. A frame that needs more than a
+ * region grows the storage (the old buffer is orphaned, never waited on), so
+ * the attributes must be re-pointed on every draw.
+ *
+ * Usage per draw (GL thread): Allocate() -> write -> Commit() -> point
+ * attributes -> draw; once per frame, after the last draw: EndFrame().
+ */
+class StreamBuffer {
+private:
+    static constexpr int REGION_COUNT = 3; // Frames in flight
+
+    // Allocations start on this boundary (covers every vertex attribute type).
+    static constexpr GLsizeiptr ALIGNMENT = 16;
+
+    GLuint m_VBO = 0;
+
+    GLsizeiptr m_regionBytes = 0; // Size of one frame's region
+    bool m_persistent = false;    // glBufferStorage path in use?
+
+    // Persistent path: base of the whole mapping + one fence per region.
+    char* m_mappedBase = nullptr;
+    GLsync m_fences[REGION_COUNT] = {};
+
+    int m_region = 0;             // Region being written this frame
+    GLsizeiptr m_offset = 0;      // Write cursor inside the current region
+    bool m_regionReady = false;   // Fence waited on / buffer orphaned for this frame
+    bool m_mappedForWrite = false; // Fallback path: a glMapBufferRange is outstanding
+
+    /**
+     * @brief Creates the VBO with room for regionBytes per frame (persistent if possible).
+     */
+    void createStorage(GLsizeiptr regionBytes);
+    void destroyStorage();
+    void beginRegion();
+
+public:
+    /**
+     * @param regionBytes Initial bytes per frame (the VBO is 3x this when persistent).
+     */
+    explicit StreamBuffer(GLsizeiptr regionBytes = 64 * 1024);
+    ~StreamBuffer();
+
+    StreamBuffer(const StreamBuffer&) = delete;
+    StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+    /**
+     * @brief Reserves bytes in this frame's region, growing the storage if needed.
+     * @param offset Receives the byte offset of the allocation in getBuffer().
+     * @return Pointer to write the data into, or nullptr if bytes <= 0 or
+     * mapping failed (the draw should be skipped).
+     */
+    void* Allocate(GLsizeiptr bytes, GLintptr& offset);
+
+    /**
+     * @brief Finishes writing the last allocation (unmaps on the fallback path).
+     */
+    void Commit();
+
+    /**
+     * @brief Fences this frame's region and moves on to the next one.
+     */
+    void EndFrame();
+
+    GLuint getBuffer() const { return m_VBO; }
+    bool isPersistent() const { return m_persistent; }
+};
+
+} // namespace EchoDrift::Rendering
@@ -0,0 +1,183 @@
+#pragma once
+
+#include "Rendering/GLCommon.h"
+#include <cstdint>
+#include <vector>
+
+namespace EchoDrift::Rendering {
+
+/**
+ * @brief One trail vertex: grid cell, RGBA8 color, and the simulation tick the
+ * cell was laid down (drives fading/pulsing on the GPU). 12 bytes, read by the
+ * trail shader as three R32UI texels.
+ */
+struct TrailVertex {
+    GLushort cell[2];
+    GLubyte color[4];
+    GLuint tick; // Low 32 bits of GameManager::getTickCount(); ages are taken modulo 2^32
+};
+
+// Two triangles per trail segment (segment i joins vertices i and i + 1).
+constexpr GLsizei TRAIL_SEGMENT_VERTICES = 6;
+
+/**
+ * @brief Everything the GL thread needs to bring the trail VBO up to date and
+ * draw one frame's trails. Filled by TrailBatch::TakeFrame on the game thread.
+ */
+struct TrailFrame {
+    bool fullUpload = false;          // Storage was repacked: re-specify the whole VBO
+    GLsizei capacity = 0;             // VBO size in vertices (for a full upload)
+    std::vector<TrailVertex> vertices; // Full image, or the values of dirtyIndices
+    std::vector<GLint> dirtyIndices;   // Sorted, unique (partial upload only)
+    std::vector<GLint> firsts;         // glMultiDrawArrays arguments, in segment
+    std::vector<GLsizei> counts;       // vertices (TRAIL_SEGMENT_VERTICES per segment)
+
+    void Clear() {
+        fullUpload = false;
+        vertices.clear();
+        dirtyIndices.clear();
+        firsts.clear();
+        counts.clear();
+    }
+};
+
+/**
+ * @class TrailBatch
+ * @brief Every trail's vertices in one shared VBO, drawn with a single glMultiDrawArrays.
+ *
+ * Each trail owns a range (first, count, capacity) inside the shared buffer.
+ * Appends go to the end of the range; a full range is moved to a new range of
+ * twice the size at the top of the buffer. Dropped tails and abandoned ranges
+ * are dead space that is packed away the next time the buffer runs out of
+ * room, so the storage stays within a constant factor of the live data.
+ *
+ * The layout is maintained on the game thread against a CPU image of the
+ * buffer, without touching GL: TakeFrame() collects the vertices written since
+ * the last frame, and Upload()/Draw() replay them on whichever thread owns the
+ * GL context. The color lives in the vertices, so the number of draw calls
+ * does not depend on the number of trails.
+ *
+ * Trails are drawn as ribbons, not lines: the VBO is also exposed as a buffer
+ * texture, and every segment is a quad whose vertex shader fetches its two end
+ * points by gl_VertexID and expands them to the ribbon width. No vertex
+ * attributes and no CPU-side triangulation.
+ *
+ * The buffer texture caps the whole batch at GL_MAX_TEXTURE_BUFFER_SIZE texels
+ * (only 65536 guaranteed, about 21.8k vertices). Growth stops there: ranges
+ * then grow in small steps into whatever packing frees, and once nothing is
+ * left a trail's further appends are dropped (logged once), never drawn
+ * past the end of the texture.
+ */
+class TrailBatch {
+public:
+    using RangeId = std::uint32_t;
+    static constexpr RangeId NO_RANGE = ~RangeId(0);
+
+private:
+    struct Range {
+        GLint first = 0;      // First live vertex in the shared buffer
+        GLsizei count = 0;    // Live vertices
+        GLsizei capacity = 0; // Vertices reserved from first
+        bool inUse = false;
+    };
+
+    // --- GL side (GL thread) ---
+    GLuint m_VAO = 0;     // Empty: the shader pulls its vertices from m_texture
+    GLuint m_VBO = 0;
+    GLuint m_texture = 0; // Buffer texture over m_VBO
+
+    // --- Layout (game thread) ---
+    std::vector<TrailVertex> m_image; // CPU copy of the whole buffer
+    GLsizei m_maxVertices = 0;        // What the buffer texture can address
+    bool m_limitReported = false;
+    GLsizei m_top = 0;                // Bump pointer: everything above is free
+    GLsizei m_deadVertices = 0;       // Reserved below m_top but owned by no range
+
+    std::vector<Range> m_ranges;
+    std::vector<RangeId> m_freeIds;
+
+    // Written since the last TakeFrame (ignored after a repack: all is re-sent).
+    std::vector<GLint> m_dirty;
+    bool m_repacked = true;
+
+    // This frame's submitted ranges (glMultiDrawArrays arguments).
+    std::vector<GLint> m_drawFirsts;
+    std::vector<GLsizei> m_drawCounts;
+
+    /**
+     * @brief Reserves vertexCount vertices at the top, packing/growing the image if needed.
+     * @return First reserved vertex, or -1 if it cannot fit under m_maxVertices.
+     */
+    GLint allocate(GLsizei vertexCount);
+
+    /**
+     * @brief Moves every live range into an image of newCapacity, back to back
+     * (the range `last`, if given, goes on top so it can be extended in place).
+     */
+    void repack(GLsizei newCapacity, RangeId last = NO_RANGE);
+
+    /**
+     * @brief At the texture limit: makes the range `id` topmost and extends it
+     * in place by vertexCount. False if even that does not fit.
+     */
+    bool extendAtLimit(RangeId id, GLsizei vertexCount);
+
+    void write(GLint vertexIndex, const TrailVertex& vertex);
+
+public:
+    TrailBatch(); // Needs a current GL context (creates the VAO/VBO/texture)
+    ~TrailBatch();
+
+    TrailBatch(const TrailBatch&) = delete;
+    TrailBatch& operator=(const TrailBatch&) = delete;
+
+    // --- Game thread ---
+
+    RangeId CreateRange();
+    void DestroyRange(RangeId range);
+
+    /**
+     * @brief Adds a vertex after the range's last one (amortized O(1)).
+     * Dropped if the batch is at the texture buffer limit.
+     */
+    void Append(RangeId range, const TrailVertex& vertex);
+
+    /**
+     * @brief Overwrites one live vertex of the range (index 0 = first live vertex).
+     */
+    void UpdateVertex(RangeId range, GLsizei index, const TrailVertex& vertex);
+
+    /**
+     * @brief Stops drawing the range's oldest vertices (expired trail tail).
+     */
+    void DropFront(RangeId range, GLsizei vertexCount);
+
+    GLsizei getVertexCount(RangeId range) const { return m_ranges[range].count; }
+
+    /**
+     * @brief Queues the range's segments for this frame's draw (nothing below two vertices).
+     */
+    void Submit(RangeId range);
+
+    /**
+     * @brief Moves this frame's vertex changes and submitted ranges into frame.
+     */
+    void TakeFrame(TrailFrame& frame);
+
+    GLsizei getSubmittedCount() const { return static_cast<GLsizei>(m_drawFirsts.size()); }
+
+    // --- GL thread ---
+
+    /**
+     * @brief Applies the frame's vertex changes to the VBO.
+     */
+    void Upload(const TrailFrame& frame);
+
+    /**
+     * @brief Draws the frame's ranges as ribbons with one glMultiDrawArrays.
+     * The caller must have the trail shader in use (buffer texture on unit 0).
+     */
+    void Draw(const TrailFrame& frame);
+};
+
+} // namespace EchoDrift::Rendering
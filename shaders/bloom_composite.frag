@@ -0,0 +1,15 @@
+#version 330 core
+// Scene plus bloom, written to the window (clamped there, as before bloom).
+in vec2 vUV;
+out vec4 FragColor;
+
+uniform sampler2D uScene; // Unit 0
+uniform sampler2D uBloom; // Unit 1
+uniform float uIntensity;
+
+void main()
+{
+    vec3 scene = texture(uScene, vUV).rgb;
+    vec3 bloom = texture(uBloom, vUV).rgb;
+    FragColor = vec4(scene + bloom * uIntensity, 1.0);
+}
@@ -0,0 +1,26 @@
+#version 330 core
+// Dual-filter downsample: center plus four diagonal taps, each a bilinear
+// average of four source texels.
+in vec2 vUV;
+out vec4 FragColor;
+
+uniform sampler2D uSource;
+uniform vec2 uHalfPixel;  // Half a destination pixel, in UV
+uniform float uThreshold; // > 0 only for the first level (bright pass)
+
+void main()
+{
+    vec3 sum = texture(uSource, vUV).rgb * 4.0;
+    sum += texture(uSource, vUV - uHalfPixel).rgb;
+    sum += texture(uSource, vUV + uHalfPixel).rgb;
+    sum += texture(uSource, vUV + vec2(uHalfPixel.x, -uHalfPixel.y)).rgb;
+    sum += texture(uSource, vUV - vec2(uHalfPixel.x, -uHalfPixel.y)).rgb;
+    vec3 color = sum / 8.0;
+
+    if (uThreshold > 0.0) {
+        // Keep only what is brighter than the threshold (hue preserved)
+        float brightness = max(color.r, max(color.g, color.b));
+        color *= max(brightness - uThreshold, 0.0) / max(brightness, 1e-4);
+    }
+    FragColor = vec4(color, 1.0);
+}
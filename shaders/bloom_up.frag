@@ -0,0 +1,22 @@
+#version 330 core
+// Dual-filter upsample: eight taps on a diamond around the pixel (the
+// diagonal ones weighted double). Added onto the level above by blending.
+in vec2 vUV;
+out vec4 FragColor;
+
+uniform sampler2D uSource;
+uniform vec2 uHalfPixel; // Half a destination pixel, in UV
+
+void main()
+{
+    vec2 h = uHalfPixel;
+    vec3 sum = texture(uSource, vUV + vec2(-2.0 * h.x, 0.0)).rgb;
+    sum += texture(uSource, vUV + vec2(-h.x, h.y)).rgb * 2.0;
+    sum += texture(uSource, vUV + vec2(0.0, 2.0 * h.y)).rgb;
+    sum += texture(uSource, vUV + vec2(h.x, h.y)).rgb * 2.0;
+    sum += texture(uSource, vUV + vec2(2.0 * h.x, 0.0)).rgb;
+    sum += texture(uSource, vUV + vec2(h.x, -h.y)).rgb * 2.0;
+    sum += texture(uSource, vUV + vec2(0.0, -2.0 * h.y)).rgb;
+    sum += texture(uSource, vUV + vec2(-h.x, -h.y)).rgb * 2.0;
+    FragColor = vec4(sum / 12.0, 1.0);
+}
@@ -0,0 +1,12 @@
+#version 330 core
+// Fullscreen triangle from gl_VertexID alone (no vertex buffer):
+// (-1,-1), (3,-1), (-1,3) covers the whole viewport.
+
+out vec2 vUV; // 0..1 across the viewport
+
+void main()
+{
+    vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    vUV = corner;
+    gl_Position = vec4(corner * 2.0 - 1.0, 0.0, 1.0);
+}
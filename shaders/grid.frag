@@ -0,0 +1,20 @@
+#version 330 core
+in vec2 vCell;
+out vec4 FragColor;
+
+uniform vec3 uColor;      // Line color
+uniform float uLineWidth; // Line width in pixels
+
+void main()
+{
+    // Distance to the nearest grid line in pixels: cells to the line, divided
+    // by how many cells one pixel spans (fwidth). Stays sharp at any zoom.
+    vec2 toLine = abs(fract(vCell - 0.5) - 0.5) / fwidth(vCell);
+    float distance = min(toLine.x, toLine.y);
+
+    // One-pixel antialiased edge around a line of uLineWidth pixels
+    float coverage = clamp(0.5 * uLineWidth + 0.5 - distance, 0.0, 1.0);
+    if (coverage <= 0.0) discard;
+
+    FragColor = vec4(uColor, coverage);
+}
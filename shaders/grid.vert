@@ -0,0 +1,17 @@
+#version 330 core
+// Fullscreen triangle from gl_VertexID alone (no vertex buffer):
+// (-1,-1), (3,-1), (-1,3) covers the whole viewport.
+
+uniform vec2 uGridSize; // Grid width/height in cells
+
+out vec2 vCell; // Position in grid cells; lines sit on integer values
+
+void main()
+{
+    vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    vec2 ndc = corner * 2.0 - 1.0;
+    gl_Position = vec4(ndc, 0.0, 1.0);
+
+    // Inverse of the cell -> NDC mapping used for the line VBO
+    vCell = (ndc + 1.0) * 0.5 * uGridSize;
+}
@@ -0,0 +1,8 @@
+#version 330 core
+in vec4 vColor;     // Per-instance quad color
+out vec4 FragColor; // The final color output
+
+void main()
+{
+    FragColor = vColor;
+}
@@ -0,0 +1,18 @@
+#version 330 core
+layout (location = 0) in vec2 aCorner; // Unit quad corner (-0.5..0.5), per vertex
+layout (location = 1) in vec2 aCenter; // Grid cell (fractional while moving), per instance
+layout (location = 2) in vec4 aColor;  // RGBA8 color, per instance
+layout (location = 3) in float aSize;  // Edge length in cells, per instance
+
+uniform vec2 uGridSize; // Grid width/height in cells
+
+out vec4 vColor;
+
+void main()
+{
+    // Same cell -> NDC mapping as the trail shader
+    vec2 cell = aCenter + aCorner * aSize;
+    vec2 ndc = (cell + 0.5) / uGridSize * 2.0 - 1.0;
+    gl_Position = vec4(ndc, 0.0, 1.0);
+    vColor = aColor;
+}
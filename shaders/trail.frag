@@ -0,0 +1,30 @@
+#version 330 core
+in vec4 vColor;     // Per-vertex trail color from the batch
+in float vAcross;   // Signed distance from the ribbon's center line, in cells
+in vec2 vAlong;     // Distance past the segment's start edge / before its end edge, in cells
+in float vAge;      // Ticks since this point was laid down
+out vec4 FragColor; // The final color output
+
+uniform float uTrailWidth;  // Ribbon width in cells
+uniform float uFadeTicks;   // Age at which the trail reaches...
+uniform float uFadeFloor;   // ...this brightness (kept > 0: trails are walls)
+uniform float uPulsePeriod; // Ticks between pulses travelling down the trail
+uniform float uPulseAmount; // Extra brightness at a pulse's peak
+
+void main()
+{
+    // Analytic edge antialiasing: signed distance to the true edge in pixels
+    // (fwidth converts cells to pixels), taken as box-filter pixel coverage.
+    // The quad extends a pixel past every edge, so the ramp is never cut off.
+    float toSide = (0.5 * uTrailWidth - abs(vAcross)) / max(fwidth(vAcross), 1e-6);
+    vec2 toEnds = vAlong / max(fwidth(vAlong), vec2(1e-6));
+    float coverage = clamp(toSide + 0.5, 0.0, 1.0) *
+                     clamp(toEnds.x + 0.5, 0.0, 1.0) * clamp(toEnds.y + 0.5, 0.0, 1.0);
+
+    // Older parts dim; a pulse runs from the head towards the tail as the
+    // age of every point grows (peaks may exceed 1 and feed the bloom).
+    float fade = mix(1.0, uFadeFloor, clamp(vAge / uFadeTicks, 0.0, 1.0));
+    float pulse = 1.0 + uPulseAmount * (0.5 + 0.5 * cos(6.2831853 * vAge / uPulsePeriod));
+
+    FragColor = vec4(vColor.rgb * fade * pulse, vColor.a * coverage);
+}
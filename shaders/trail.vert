@@ -0,0 +1,87 @@
+#version 330 core
+// Trail ribbons without vertex attributes: every segment is a quad (two
+// triangles, 6 vertices), and segment s joins trail vertices s and s + 1,
+// fetched from the trail buffer by gl_VertexID.
+
+uniform usamplerBuffer uTrailVertices; // Three R32UI texels per vertex: cell (x | y << 16), RGBA8 color, tick
+uniform vec2 uGridSize;    // Grid width/height in cells
+uniform float uTrailWidth; // Ribbon width in cells
+uniform vec2 uPixelSize;   // One pixel of the render target, in cells (per axis)
+uniform uint uCurrentTick; // Simulation tick being drawn...
+uniform float uTickAlpha;  // ...plus the fraction of the next one already elapsed
+
+out vec4 vColor;
+out float vAcross; // Signed distance from the ribbon's center line, in cells
+out vec2 vAlong;   // Distance past the segment's start edge / before its end edge, in cells
+out float vAge;    // Ticks since this point of the trail was laid down
+
+// (along, side) per quad vertex: along 0 = segment start, 1 = segment end
+const vec2 QUAD_CORNERS[6] = vec2[6](
+    vec2(0.0, -1.0), vec2(1.0, -1.0), vec2(0.0, 1.0),
+    vec2(0.0, 1.0), vec2(1.0, -1.0), vec2(1.0, 1.0)
+);
+
+vec2 fetchCell(int vertex)
+{
+    uint packed = texelFetch(uTrailVertices, vertex * 3).r;
+    return vec2(packed & 0xFFFFu, packed >> 16u) + 0.5; // Cell center
+}
+
+vec4 fetchColor(int vertex)
+{
+    uint packed = texelFetch(uTrailVertices, vertex * 3 + 1).r;
+    return vec4(packed & 0xFFu, (packed >> 8u) & 0xFFu, (packed >> 16u) & 0xFFu, packed >> 24u) / 255.0;
+}
+
+float fetchAge(int vertex)
+{
+    // Unsigned subtraction: correct across the 32-bit tick wrap
+    uint tick = texelFetch(uTrailVertices, vertex * 3 + 2).r;
+    return float(uCurrentTick - tick) + uTickAlpha;
+}
+
+void main()
+{
+    int segment = gl_VertexID / 6;
+    vec2 corner = QUAD_CORNERS[gl_VertexID - segment * 6];
+
+    vColor = fetchColor(segment);
+    vec2 start = fetchCell(segment);
+    vec2 end = fetchCell(segment + 1);
+    vec2 delta = end - start;
+    float len = length(delta);
+    if (len < 1e-4) {
+        // Repeated vertex (e.g. a fresh corner): collapse to nothing
+        gl_Position = vec4(0.0, 0.0, 0.0, 1.0);
+        vAcross = 0.0;
+        vAlong = vec2(0.0);
+        vAge = 0.0;
+        return;
+    }
+
+    vec2 direction = delta / len;
+    vec2 normal = vec2(-direction.y, direction.x);
+    float halfWidth = 0.5 * uTrailWidth;
+
+    // Joins: shift the whole segment forward by half a width. Its end then
+    // fills the outer square of a 90-degree turn (the miter of a right angle)
+    // and the next segment starts exactly where that square ends, so no
+    // pixel is covered twice (which additive blending would show).
+    // The quad is then padded by a pixel on every side so the fragment shader
+    // can filter each edge over its whole footprint; where two segments meet,
+    // their coverages ramp across the shared edge and still sum to one.
+    vec2 padding = 1.0 / vec2(length(normal / uPixelSize), length(direction / uPixelSize));
+    float across = corner.y * (halfWidth + padding.x);
+    float along = mix(-padding.y, len + padding.y, corner.x); // From the start edge
+    float t = (halfWidth + along) / len; // Position along start -> end
+    vec2 cell = mix(start, end, t) + normal * across;
+    vAcross = across;
+    vAlong = vec2(along, len - along);
+
+    // One cell per tick along a straight run, so age is linear between the ends
+    vAge = mix(fetchAge(segment), fetchAge(segment + 1), t);
+
+    // Grid cells -> NDC (same mapping as Grid::gridToScreen, done on the GPU)
+    vec2 ndc = cell / uGridSize * 2.0 - 1.0;
+    gl_Position = vec4(ndc, 0.0, 1.0);
+}
@@ -0,0 +1,12 @@
+#version 330 core
+// Scene target to window, bilinear (used when the scene renders below native
+// resolution without bloom; the bloom composite upscales on its own).
+in vec2 vUV;
+out vec4 FragColor;
+
+uniform sampler2D uScene; // Unit 0
+
+void main()
+{
+    FragColor = vec4(texture(uScene, vUV).rgb, 1.0);
+}
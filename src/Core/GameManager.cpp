@@ -5,6 +5,8 @@
 #include <iostream>            // For basic logging
 #include <utility>             // For std::move
 #include <iterator>            // <-- FIX: Added for range-based for loops (begin/end)
+#include <cmath>               // For std::fmod
+#include <algorithm>           // For std::fill
 
 namespace EchoDrift::Core {
 
@@ -12,6 +14,14 @@ using EchoDrift::Game::Grid;
 using EchoDrift::Entities::Echo;
 using EchoDrift::Entities::Ghost;
 using EchoDrift::Game::GRID_SIZE;
+using EchoDrift::Game::MoveValidator;
+using EchoDrift::Game::EMPTY_OWNER;
+using EchoDrift::Game::WALL_OWNER;
+using EchoDrift::Entities::Entity;
+using EchoDrift::Entities::EntityId;
+using EchoDrift::Entities::MoveOutcome;
+using EchoDrift::Entities::MoveResult;
+using EchoDrift::Entities::Vec2;
 
 /**
  * @brief Initializes game components and entities.
@@ -27,6 +37,14 @@ void GameManager::Init(GLFWwindow* window) {
     // Initialize Grid
     m_grid = std::make_unique<Grid>();
 
+    // Trail vertices are grid cells; the trail shader needs the grid size to place them
+    m_renderer.setGridSize(m_grid->getWidth(), m_grid->getHeight());
+
+    // Per-tick claim maps for the move resolution pass
+    m_claimedCells.resize(m_grid->getWidth(), m_grid->getHeight());
+    m_contestedCells.resize(m_grid->getWidth(), m_grid->getHeight());
+    std::cout << "Move validation kernel: " << (MoveValidator::usingAVX2() ? "AVX2" : "scalar") << std::endl;
+
     // Initialize Player Echo
     m_playerEcho = std::make_unique<Echo>(m_grid.get(), GRID_SIZE / 2, GRID_SIZE / 2);
 
@@ -38,6 +56,9 @@ void GameManager::Init(GLFWwindow* window) {
         GRID_SIZE / 4
     )); // <-- FIX: Closed the parenthesis for std::make_unique/Ghost constructor
 
+    // Apply the current trail cap (if any) to everyone just spawned
+    setMaxTrailLength(m_maxTrailLength);
+
     // Subscribe player input handler to directional changes
     // Assuming InputManager::SubscribeToDirection expects a DirectionCallback
     InputManager::GetInstance().SubscribeToDirection([this](Direction d) {
@@ -46,11 +67,44 @@ void GameManager::Init(GLFWwindow* window) {
         }
     });
 
+    // All GL resources exist now; from here on the render thread owns the context
+    m_renderer.StartRenderThread(m_window);
+
     std::cout << "GameManager initialized successfully." << std::endl;
 }
 
+GameManager::GameManager() = default;
+GameManager::~GameManager() = default;
+
 /**
- * @brief Updates the game state every frame.
+ * @brief Tears the game down while the GL context is still alive.
+ */
+void GameManager::Shutdown() {
+    // Context back on this thread first: the destructors below make GL calls.
+    m_renderer.StopRenderThread();
+
+    // Entities before the renderer: their trails return ranges to its TrailBatch.
+    m_ghosts.clear();
+    m_playerEcho.reset();
+    m_grid.reset();
+
+    m_renderer.Shutdown();
+    std::cout << "GameManager shut down." << std::endl;
+}
+
+/**
+ * @brief Stores the trail cap and applies it to the player and every ghost.
+ */
+void GameManager::setMaxTrailLength(std::size_t maxLength) {
+    m_maxTrailLength = maxLength;
+    if (m_playerEcho) m_playerEcho->setMaxTrailLength(m_maxTrailLength);
+    for (const auto& ghost : m_ghosts) {
+        ghost->setMaxTrailLength(m_maxTrailLength);
+    }
+}
+
+/**
+ * @brief Advances the simulation by however many fixed ticks fit in the elapsed time.
  * @param deltaTime Time elapsed since the last frame.
  */
 void GameManager::Update(float deltaTime) {
@@ -59,30 +113,151 @@ void GameManager::Update(float deltaTime) {
     }
     
     // Update InputManager state (e.g., check for key presses)
+    // Input is polled every frame so a key press is never missed between ticks.
     InputManager::GetInstance().Update();
 
-    // Update Player Echo
-    m_playerEcho->Update(deltaTime);
+    // Fixed-timestep loop: bank the frame time, then spend it one tick at a time.
+    m_tickAccumulator += deltaTime;
 
-    // Update Ghosts
-    // FIX START: std::begin/std::end is now available thanks to <iterator>
+    int ticksThisFrame = 0;
+    while (m_tickAccumulator >= TICK_INTERVAL && ticksThisFrame < MAX_CATCH_UP_TICKS) {
+        Tick();
+        m_tickAccumulator -= TICK_INTERVAL;
+        ++ticksThisFrame;
+
+        if (m_currentState != GameState::RUNNING) {
+            m_tickAccumulator = 0.0f;
+            break;
+        }
+    }
+
+    // After a long stall (debugger, window drag) drop the backlog we could not
+    // catch up on instead of spiralling into ever longer frames.
+    if (m_tickAccumulator >= TICK_INTERVAL) {
+        m_tickAccumulator = std::fmod(m_tickAccumulator, TICK_INTERVAL);
+    }
+
+    // How far we are between the last tick and the next one (0..1).
+    m_interpolationAlpha = m_tickAccumulator / TICK_INTERVAL;
+}
+
+/**
+ * @brief Runs exactly one fixed simulation step.
+ */
+void GameManager::Tick() {
+    ++m_tickCount;
+
+    // Everyone taking part in this tick (player first, then ghosts).
+    m_tickEntities.clear();
+    m_tickEntities.push_back(m_playerEcho.get());
     for (const auto& ghost : m_ghosts) {
-        ghost->Update(deltaTime);
+        m_tickEntities.push_back(ghost.get());
     }
-    // FIX END
 
-    // TODO: Check for collisions and update state if necessary
-    // Example: checkCollision(m_playerEcho.get(), m_ghosts);
+    // Snapshot positions so rendering can interpolate from here to the new ones.
+    for (Entity* entity : m_tickEntities) {
+        entity->BeginTick();
+    }
+
+    // 1. Propose: each entity picks a target without touching shared state,
+    //    so this loop has no ordering dependencies (and could run in parallel).
+    m_moves.clear();
+    for (Entity* entity : m_tickEntities) {
+        m_moves.push(entity->proposeMove(*m_grid));
+    }
+
+    // 2. Resolve: one pass decides every collision against the same snapshot.
+    resolveMoves();
+
+    // 3. Apply: winners claim their cells; losers react (game over, neutralized...).
+    for (std::size_t i = 0; i < m_tickEntities.size(); ++i) {
+        m_tickEntities[i]->resolveMove(m_moves.position(i), m_moveResults[i], *m_grid);
+    }
+}
+
+/**
+ * @brief Classifies every proposal as stayed/moved/wall/trail/head-on/swap.
+ */
+void GameManager::resolveMoves() {
+    const std::size_t count = m_tickEntities.size();
+    m_moveResults.assign(count, MoveResult{});
+
+    // Bounds + owner of every target cell in one batched (SIMD) pass.
+    MoveValidator::Validate(*m_grid, m_moves);
+
+    // ID -> index lookup for swap detection.
+    std::fill(m_entityIndexById.begin(), m_entityIndexById.end(), -1);
+    for (std::size_t i = 0; i < count; ++i) {
+        const EntityId id = m_tickEntities[i]->getId();
+        if (id >= m_entityIndexById.size()) {
+            m_entityIndexById.resize(static_cast<std::size_t>(id) + 1, -1);
+        }
+        m_entityIndexById[id] = static_cast<int>(i);
+    }
+
+    // Pass 1: walls, trails and swaps; free targets are claimed in the bitmap.
+    for (std::size_t i = 0; i < count; ++i) {
+        const Vec2 from = m_tickEntities[i]->getPosition();
+        const Vec2 to = m_moves.position(i);
+        MoveResult& result = m_moveResults[i];
+
+        if (to == from) continue; // STAYED
+
+        const EntityId owner = m_moves.owners[i];
+        if (owner == WALL_OWNER) {
+            result.outcome = MoveOutcome::WALL;
+        } else if (owner != EMPTY_OWNER) {
+            result.outcome = MoveOutcome::TRAIL;
+            result.other = owner;
+
+            // Moving onto someone's head while they move onto ours is a swap.
+            const int j = owner < m_entityIndexById.size() ? m_entityIndexById[owner] : -1;
+            if (j >= 0 && static_cast<std::size_t>(j) != i &&
+                m_moves.position(j) == from && m_tickEntities[j]->getPosition() == to) {
+                result.outcome = MoveOutcome::SWAP;
+            }
+        } else {
+            // Free cell: claim it, remembering if someone already has this tick.
+            if (m_claimedCells.test(to.x, to.y)) {
+                m_contestedCells.set(to.x, to.y);
+            } else {
+                m_claimedCells.set(to.x, to.y);
+            }
+            result.outcome = MoveOutcome::MOVED;
+        }
+    }
+
+    // Pass 2: everyone who claimed a contested cell loses it; then reset both maps.
+    for (std::size_t i = 0; i < count; ++i) {
+        if (m_moveResults[i].outcome != MoveOutcome::MOVED) continue;
+        const Vec2 to = m_moves.position(i);
+        if (m_contestedCells.test(to.x, to.y)) {
+            m_moveResults[i].outcome = MoveOutcome::HEAD_ON;
+        }
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        const MoveOutcome outcome = m_moveResults[i].outcome;
+        if (outcome != MoveOutcome::MOVED && outcome != MoveOutcome::HEAD_ON) continue;
+        const Vec2 to = m_moves.position(i);
+        m_claimedCells.reset(to.x, to.y);
+        m_contestedCells.reset(to.x, to.y);
+    }
 }
 
 /**
  * @brief Renders the game components to the screen.
  */
 void GameManager::Render() {
+    // Entities use this to draw between their previous and current cells.
+    m_renderer.setInterpolationAlpha(m_interpolationAlpha);
+
+    // Trails fade and pulse on the GPU by comparing their vertices' ticks to this one.
+    m_renderer.setCurrentTick(m_tickCount);
+
     m_renderer.Clear();
 
-    // Render Grid/Background (Mock)
-    m_renderer.DrawSquare(0, 0);
+    // Render Grid/Background
+    m_grid->Render(m_renderer);
 
     // Render Player Echo
     m_playerEcho->Render(m_renderer);
@@ -94,7 +269,15 @@ void GameManager::Render() {
     }
     // FIX END
 
-    m_renderer.SwapBuffers(m_window);
+    // All trails queued above go out in a single draw call
+    m_renderer.DrawTrails();
+
+    // Then every head on top of them, also in a single (instanced) call
+    m_renderer.DrawQuads();
+
+    // Hand the recorded frame over for sorting, execution and presenting
+    // (on the render thread, which overlaps it with our next frame)
+    m_renderer.EndFrame(m_window);
 }
 
 } // namespace EchoDrift::Core
@@ -15,66 +15,25 @@ using EchoDrift::Game::Grid;
 // Constructor and Input
 // ------------------------------------------------------------------
 
-Echo::Echo(int startX, int startY) : Entity(startX, startY) {
-    m_trailHistory.push_back(getPosition());
-    // NEW: Initialize the buffer
-    m_buffer = std::make_unique<EchoDrift::Rendering::Buffer>();
-}
+Echo::Echo(Grid* grid, int startX, int startY)
+    : Entity(startX, startY),
+      m_trail(*grid, getId(), getPosition(), GameManager::GetInstance().getTickCount(),
+              GameManager::GetInstance().getRenderer().getTrailBatch(), 0.2f, 0.5f, 0.8f) {} // Trail color (dim blue)
 
 void Echo::handleInput(EchoDrift::Core::Direction d) {
     // ... (Your previous input logic, including the reversal check if implemented) ...
     m_currentDirection = d;
 }
 
-// ------------------------------------------------------------------
-// Geometry Generation Logic
-// ------------------------------------------------------------------
-
-void Echo::generateTrailGeometry(const Grid& grid) {
-    std::vector<float> vertices;
-    
-    // Convert all trail history points to NDC
-    for (const auto& gridPos : m_trailHistory) {
-        Vec2 screenPos = grid.gridToScreen(gridPos);
-        vertices.push_back(screenPos.x); 
-        vertices.push_back(screenPos.y); 
-    }
-    
-    // NEW: The Buffer::SetData will now hold the vertices for a GL_LINE_STRIP.
-    m_buffer->SetData(vertices); 
-}
-
 // ------------------------------------------------------------------
 // Core Loop Implementations
 // ------------------------------------------------------------------
 
-void Echo::Update(float dt) {
-    m_moveTimer += dt;
-    
-    if (m_moveTimer >= MOVE_INTERVAL) {
-    
-    // --- ALL EXISTING MOVEMENT, COLLISION, AND POSITION UPDATE LOGIC GOES HERE ---
-    
-    // Example: 
-    // Vec2 newPos = getPosition();
-    // // ... calculate newPos ...
-    // // ... collision checks ...
-    // setPosition(newPos);
-    
-    // --- END OF LOGIC ---
-    
-    // 3. Reset the timer
-    m_moveTimer = 0.0f; // Reset to 0 or subtract MOVE_INTERVAL for precision
-    
-    }
-    // Get the required system references
-    GameManager& gm = GameManager::GetInstance();
-    Grid* grid = gm.getGrid();
-    if (!grid) return;
-    
-    // 1. Check if we should even attempt a move (based on direction)
+// Phase 1 of the GameManager's tick: where would the Echo like to go?
+Vec2 Echo::proposeMove(const Grid& /*grid*/) {
+    // 1. No direction yet means we stay put this tick
     if (m_currentDirection == Core::Direction::NONE) {
-        return; 
+        return getPosition(); 
     }
 
     // 2. Calculate next position
@@ -86,77 +45,71 @@ void Echo::Update(float dt) {
         case Core::Direction::RIGHT: newPos.x += 1; break;
         default: break;
     }
+    return newPos;
+}
+
+// Phase 3: the GameManager has judged every move at once; act on the verdict.
+void Echo::resolveMove(const Vec2& newPos, const MoveResult& result, Grid& /*grid: claimed through m_trail*/) {
+    GameManager& gm = GameManager::GetInstance();
 
     // ===================================
-    //  COLLISION CHECK BLOCK
+    //  COLLISION OUTCOME BLOCK
     // ===================================
 
-    // A. Boundary Collision Check
-    if (newPos.x < 0 || newPos.x >= grid->getWidth() || 
-        newPos.y < 0 || newPos.y >= grid->getHeight()) 
-    {
-        std::cout << "Collision! Boundary hit. Game Over." << std::endl;
-        gm.setState(Core::GameState::GAME_OVER);
-        return; 
-    }
-    
-    // B. Self-Collision Check
-    // We check against ALL existing trail segments
-    for (size_t i = 0; i < m_trailHistory.size(); ++i) {
-        const Vec2& trailSegment = m_trailHistory[i];
-        
-        if (newPos.x == trailSegment.x && newPos.y == trailSegment.y) {
-            std::cout << "Collision! Self-trail hit. Game Over." << std::endl;
+    switch (result.outcome) {
+        case MoveOutcome::STAYED:
+            return;
+        case MoveOutcome::MOVED:
+            break;
+        case MoveOutcome::WALL:
+            std::cout << "Collision! Boundary hit. Game Over." << std::endl;
+            gm.setState(Core::GameState::GAME_OVER);
+            return;
+        case MoveOutcome::TRAIL:
+            if (result.other == getId()) {
+                std::cout << "Collision! Self-trail hit. Game Over." << std::endl;
+            } else {
+                std::cout << "Collision! Ghost trail hit. Game Over." << std::endl;
+            }
+            gm.setState(Core::GameState::GAME_OVER);
+            return;
+        case MoveOutcome::HEAD_ON:
+        case MoveOutcome::SWAP:
+            std::cout << "Collision! Head-on with a Ghost. Game Over." << std::endl;
             gm.setState(Core::GameState::GAME_OVER);
             return;
-        }
     }
     
     // ===================================
-    //  END COLLISION CHECK BLOCK
+    //  END COLLISION OUTCOME BLOCK
     // ===================================
 
     // 3. Update position and trail ONLY if no collision occurred
-    m_trailHistory.push_back(newPos);
+    // (the trail claims the cell and, in bounded mode, expires its tail)
     setPosition(newPos);
-    
-    // 4. Generate and Upload Geometry (as implemented in the previous step)
-    generateTrailGeometry(*grid);
+    m_trail.Extend(newPos, gm.getTickCount());
 }
 
 
 void Echo::Render() {
-    // We need the Renderer and Shader references.
-    Renderer& renderer = Renderer::GetInstance(); // If Renderer is a Singleton
-    // OR: Renderer& renderer = GameManager::GetInstance().getRenderer();
-    
-    // Assume a public accessor for the Shader
-    const auto& shader = *renderer.getDefaultShader(); 
+    // We need the Renderer reference.
+    Renderer& renderer = GameManager::GetInstance().getRenderer();
     
-// 1. Draw the Trail
-renderer.Draw(
-    *m_buffer, 
-    shader, 
-    0.2f, 0.5f, 0.8f, // Trail color (dim blue)
-    GL_LINE_STRIP     
-);
-
-// 2. Draw the Echo's Head (as a single point for now, for a bright "dot")
-std::vector<float> headVertex;
-Vec2 headScreenPos = GameManager::GetInstance().getGrid()->gridToScreen(getPosition());
-headVertex.push_back(headScreenPos.x);
-headVertex.push_back(headScreenPos.y);
-
-// Temporarily create a buffer for the head. (More optimized to reuse a small buffer or draw a quad).
-EchoDrift::Rendering::Buffer headBuffer;
-headBuffer.SetData(headVertex);
-
-// Draw the head as a bright point (GL_POINTS)
-renderer.Draw(
-    headBuffer, 
-    shader, 
-    0.8f, 1.0f, 1.0f, // Bright cyan/white for the head
-    GL_POINTS
+// 1. Queue the Trail (drawn with all the other trails in one batch)
+m_trail.Submit();
+
+// 2. Queue the Echo's Head (an instanced quad, drawn with all other heads)
+// The head glides from last tick's cell to the current one using the
+// interpolation factor from the fixed-timestep loop.
+const float alpha = renderer.getInterpolationAlpha();
+const Vec2 prevPos = getPreviousPosition();
+const Vec2 currPos = getPosition();
+
+renderer.getQuadBatch().Add(
+    prevPos.x + (currPos.x - prevPos.x) * alpha,
+    prevPos.y + (currPos.y - prevPos.y) * alpha,
+    0.6f,            // Size in cells
+    0.8f, 1.0f, 1.0f // Bright cyan/white for the head
 );}
 
 } // namespace EchoDrift::Entities
\ No newline at end of file
@@ -10,120 +10,89 @@ using EchoDrift::Core::GameManager;
 using EchoDrift::Rendering::Renderer;
 using EchoDrift::Game::Grid;
 
-// Global random number generator (for simple AI)
-static std::mt19937 rng(std::random_device{}());
-static std::uniform_int_distribution<int> directionDist(1, 4); // Maps to UP/DOWN/LEFT/RIGHT
+// Seeds each ghost's own generator. Only touched during construction, so
+// proposeMove never shares mutable state between ghosts.
+static std::mt19937 seedRng(std::random_device{}());
 
 // ------------------------------------------------------------------
 // Constructor
 // ------------------------------------------------------------------
 
-Ghost::Ghost(int startX, int startY) : Entity(startX, startY) {
-    m_trailHistory.push_back(getPosition());
-    m_buffer = std::make_unique<EchoDrift::Rendering::Buffer>();
-}
+Ghost::Ghost(Grid* grid, int startX, int startY)
+    : Entity(startX, startY),
+      m_trail(*grid, getId(), getPosition(), GameManager::GetInstance().getTickCount(),
+              GameManager::GetInstance().getRenderer().getTrailBatch(), 0.2f, 0.5f, 0.8f), // Trail color
+      m_rng(seedRng()) {}
 
 // ------------------------------------------------------------------
-// AI and Trail Generation
+// AI
 // ------------------------------------------------------------------
 
 EchoDrift::Core::Direction Ghost::decideMove(const Grid& grid) {
     // Simple AI: Just pick a random direction
-    int randomInt = directionDist(rng);
+    std::uniform_int_distribution<int> directionDist(1, 4); // Maps to UP/DOWN/LEFT/RIGHT
+    int randomInt = directionDist(m_rng);
     return static_cast<EchoDrift::Core::Direction>(randomInt);
 }
 
-void Ghost::generateTrailGeometry(const Grid& grid) {
-    std::vector<float> vertices;
-    
-    // Draw trail as points (same as Echo for simplicity)
-    for (const auto& gridPos : m_trailHistory) {
-        Vec2 screenPos = grid.gridToScreen(gridPos);
-        vertices.push_back(screenPos.x); 
-        vertices.push_back(screenPos.y); 
-    }
-    
-    m_buffer->SetData(vertices); 
-}
-
 // ------------------------------------------------------------------
 // Core Loop Implementations
 // ------------------------------------------------------------------
 
-void Ghost::Update(float dt) {
-    m_moveTimer += dt;
-    GameManager& gm = GameManager::GetInstance();
-    Grid* grid = gm.getGrid();
-    if (!grid || gm.getState() != Core::GameState::RUNNING) return;
-
-    if (m_moveTimer >= MOVE_INTERVAL) {
-    
-    // --- ALL EXISTING MOVEMENT, COLLISION, AND POSITION UPDATE LOGIC GOES HERE ---
-    
-    // Example: 
-    // Vec2 newPos = getPosition();
-    // // ... calculate newPos ...
-    // // ... collision checks ...
-    // setPosition(newPos);
-    
-    // --- END OF LOGIC ---
-    
-    // 3. Reset the timer
-    m_moveTimer = 0.0f; // Reset to 0 or subtract MOVE_INTERVAL for precision
-    
-    }
+Vec2 Ghost::proposeMove(const Grid& grid) {
     // 1. Ghost decides where to move (Simple random AI)
-    EchoDrift::Core::Direction decidedDir = decideMove(*grid);
+    EchoDrift::Core::Direction decidedDir = decideMove(grid);
     Vec2 newPos = getPosition();
     
     switch (decidedDir) {
         case Core::Direction::UP:    newPos.y += 1; break;
-        case CoreDrift::Core::Direction::DOWN:  newPos.y -= 1; break;
-        case CoreDrift::Core::Direction::LEFT:  newPos.x -= 1; break;
-        case CoreDrift::Core::Direction::RIGHT: newPos.x += 1; break;
+        case Core::Direction::DOWN:  newPos.y -= 1; break;
+        case Core::Direction::LEFT:  newPos.x -= 1; break;
+        case Core::Direction::RIGHT: newPos.x += 1; break;
         default: break;
     }
+    return newPos;
+}
 
-    // 2. Boundary Check (Ghost can move off screen for a bit, but we'll limit it for now)
-    // Note: A simpler rule for Ghost is just to bounce off walls, but we'll stick to a basic check.
-    if (newPos.x < 0 || newPos.x >= grid->getWidth() || 
-        newPos.y < 0 || newPos.y >= grid->getHeight()) 
-    {
-        // Ignore this move if it's out of bounds and try again next frame
-        return; 
-    }
+void Ghost::resolveMove(const Vec2& newPos, const MoveResult& result, Grid& /*grid: claimed through m_trail*/) {
+    GameManager& gm = GameManager::GetInstance();
 
-    // 3. Collision with Player Trail (The Game Rule!)
-    const auto& playerTrail = gm.getPlayerEcho()->getTrailHistory(); // Assume a public accessor is added
-    for (const auto& trailSegment : playerTrail) {
-        if (newPos.x == trailSegment.x && newPos.y == trailSegment.y) {
+    // 2 + 3. Boundary and Trail Check (The Game Rule!)
+    // The GameManager has already checked walls, every trail and every other
+    // entity's move against the same snapshot of the world.
+    if (result.outcome != MoveOutcome::MOVED) {
+        if (result.outcome == MoveOutcome::TRAIL && result.other == gm.getPlayerEcho()->getId()) {
             std::cout << "GHOST HIT ECHO TRAIL! Ghost neutralized." << std::endl;
             // The Ghost is neutralized/destroyed. 
             // In a real game, this means marking the Ghost for deletion.
-            return; 
         }
+        // Walls, ghost trails and contested cells simply block the move; try again next tick.
+        return; 
     }
     
-    // 4. Commit the move
-    m_trailHistory.push_back(newPos);
+    // 4. Commit the move (the trail claims the cell and expires its tail if capped)
     setPosition(newPos);
-    
-    // 5. Generate Geometry
-    generateTrailGeometry(*grid);
+    m_trail.Extend(newPos, gm.getTickCount());
 }
 
 void Ghost::Render() {
     GameManager& gm = GameManager::GetInstance();
-    Renderer& renderer = gm.getRenderer(); // Assume a public accessor exists
     
     if (gm.getState() != Core::GameState::RUNNING) return;
 
-    // Draw the Ghost's trail and head. Use a distinct color (e.g., magenta).
-    renderer.Draw(
-        *m_buffer, 
-        shader, 
-        0.2f, 0.5f, 0.8f, // Trail color
-        GL_LINE_STRIP     // NEW: Specify how to draw the vertices
+    // Queue the Ghost's trail and head; the Renderer draws every queued trail
+    // in one call and every head in one instanced call.
+    m_trail.Submit();
+
+    Renderer& renderer = gm.getRenderer();
+    const float alpha = renderer.getInterpolationAlpha();
+    const Vec2 prevPos = getPreviousPosition();
+    const Vec2 currPos = getPosition();
+    renderer.getQuadBatch().Add(
+        prevPos.x + (currPos.x - prevPos.x) * alpha,
+        prevPos.y + (currPos.y - prevPos.y) * alpha,
+        0.6f,            // Size in cells
+        0.5f, 0.8f, 1.0f // Head color (lighter than the trail)
     );
 }
 
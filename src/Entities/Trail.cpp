@@ -0,0 +1,57 @@
+#include "Entities/Trail.h"
+#include "Game/Grid.h"
+
+namespace EchoDrift::Entities {
+
+using EchoDrift::Game::Grid;
+
+Trail::Trail(Grid& grid, EntityId owner, const Vec2& start, std::uint64_t tick,
+             EchoDrift::Rendering::TrailBatch& batch, float r, float g, float b)
+    : m_grid(grid), m_owner(owner), m_mesh(batch, r, g, b) {
+    m_cells.push_back(start);
+    m_grid.setOwner(start, m_owner);
+    m_mesh.AppendCell(start, tick);
+}
+
+Trail::~Trail() {
+    for (const Vec2& cell : m_cells) {
+        if (m_grid.getOwner(cell) == m_owner) {
+            m_grid.setOwner(cell, EchoDrift::Game::EMPTY_OWNER);
+        }
+    }
+}
+
+// ------------------------------------------------------------------
+// Growth and Expiry
+// ------------------------------------------------------------------
+
+void Trail::Extend(const Vec2& cell, std::uint64_t tick) {
+    m_cells.push_back(cell);
+    m_grid.setOwner(cell, m_owner);
+
+    // Upload the new head cell (extends or replaces the last vertex), stamped with this tick
+    m_mesh.AppendCell(cell, tick);
+
+    if (m_maxLength != 0 && m_cells.size() > m_maxLength) {
+        expireTail();
+    }
+}
+
+void Trail::expireTail() {
+    // Free the cell so others may enter it.
+    m_grid.setOwner(m_cells.front(), EchoDrift::Game::EMPTY_OWNER);
+    m_cells.pop_front();
+    m_mesh.ExpireTail(m_cells.front());
+}
+
+void Trail::setMaxLength(std::size_t maxLength) {
+    m_maxLength = maxLength;
+    if (m_maxLength == 0) return;
+
+    // Cut an existing trail back right away; the head cell always stays.
+    while (m_cells.size() > m_maxLength && m_cells.size() > 1) {
+        expireTail();
+    }
+}
+
+} // namespace EchoDrift::Entities
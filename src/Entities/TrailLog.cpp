@@ -0,0 +1,133 @@
+#include "Entities/TrailLog.h"
+#include "Core/BitOps.h"
+#include <algorithm>
+
+namespace EchoDrift::Entities {
+
+namespace {
+
+// Step codes: high bit = axis (0 = y, 1 = x), low bit = negative direction.
+constexpr unsigned STEP_UP    = 0; // y + 1
+constexpr unsigned STEP_DOWN  = 1; // y - 1
+constexpr unsigned STEP_RIGHT = 2; // x + 1
+constexpr unsigned STEP_LEFT  = 3; // x - 1
+
+// Every even bit of a word (the low bit of each 2-bit code).
+constexpr std::uint64_t LOW_BITS = 0x5555555555555555ull;
+
+} // namespace
+
+// ------------------------------------------------------------------
+// Step Encoding
+// ------------------------------------------------------------------
+
+int TrailLog::encodeStep(const Vec2& from, const Vec2& to) {
+    const int dx = to.x - from.x;
+    const int dy = to.y - from.y;
+    if (dx == 0 && dy == 1)  return STEP_UP;
+    if (dx == 0 && dy == -1) return STEP_DOWN;
+    if (dy == 0 && dx == 1)  return STEP_RIGHT;
+    if (dy == 0 && dx == -1) return STEP_LEFT;
+    return -1;
+}
+
+Vec2 TrailLog::applyStep(const Vec2& from, unsigned code) {
+    switch (code) {
+        case STEP_UP:    return Vec2(from.x, from.y + 1);
+        case STEP_DOWN:  return Vec2(from.x, from.y - 1);
+        case STEP_RIGHT: return Vec2(from.x + 1, from.y);
+        default:         return Vec2(from.x - 1, from.y);
+    }
+}
+
+// ------------------------------------------------------------------
+// Modification
+// ------------------------------------------------------------------
+
+void TrailLog::push_back(const Vec2& position) {
+    const std::size_t index = m_end;
+    if (index % STEPS_PER_WORD == 0 || m_steps.empty()) {
+        m_steps.push_back(0);
+    }
+
+    const int code = empty() ? -1 : encodeStep(m_back, position);
+    if (code < 0 || index % KEYFRAME_INTERVAL == 0) {
+        // First element, a jump (not a neighbour), or a periodic anchor.
+        m_keyframes.push_back({index, position});
+    }
+    if (code >= 0) {
+        m_steps.back() |= static_cast<std::uint64_t>(code) << ((index % STEPS_PER_WORD) * 2);
+    }
+
+    m_back = position;
+    ++m_end;
+}
+
+void TrailLog::pop_front() {
+    const std::size_t next = m_begin + 1;
+    if (next == m_end) {
+        clear();
+        return;
+    }
+
+    // Keep a keyframe on the new front: either the next keyframe already sits
+    // there, or we move the front keyframe forward by one decoded step.
+    if (m_keyframes.size() > 1 && m_keyframes[1].index == next) {
+        m_keyframes.pop_front();
+    } else {
+        Keyframe& front = m_keyframes.front();
+        front.position = applyStep(front.position, stepCode(next));
+        front.index = next;
+    }
+
+    // Release the oldest word once every step in it has expired.
+    if (next / STEPS_PER_WORD > m_firstWord) {
+        m_steps.pop_front();
+        ++m_firstWord;
+    }
+    m_begin = next;
+}
+
+void TrailLog::clear() {
+    m_steps.clear();
+    m_keyframes.clear();
+    m_firstWord = 0;
+    m_begin = 0;
+    m_end = 0;
+    m_back = Vec2();
+}
+
+// ------------------------------------------------------------------
+// Random Access
+// ------------------------------------------------------------------
+
+Vec2 TrailLog::operator[](std::size_t offset) const {
+    const std::size_t index = m_begin + offset;
+
+    // Latest keyframe at or before index (the first keyframe is always the front).
+    auto it = std::upper_bound(m_keyframes.begin(), m_keyframes.end(), index,
+        [](std::size_t value, const Keyframe& key) { return value < key.index; });
+    const Keyframe& key = *std::prev(it);
+
+    // Sum the steps in (key.index, index] a whole word at a time:
+    // count each code with popcount instead of decoding steps one by one.
+    int x = key.position.x;
+    int y = key.position.y;
+    std::size_t i = key.index + 1;
+    while (i <= index) {
+        const std::size_t shift = (i % STEPS_PER_WORD) * 2;
+        const std::size_t take = std::min(STEPS_PER_WORD - i % STEPS_PER_WORD, index - i + 1);
+        const std::uint64_t valid = (take == STEPS_PER_WORD) ? LOW_BITS : (LOW_BITS & ((std::uint64_t{1} << (take * 2)) - 1));
+
+        const std::uint64_t word = m_steps[i / STEPS_PER_WORD - m_firstWord] >> shift;
+        const std::uint64_t lo = word & valid;        // sign bit of each code
+        const std::uint64_t hi = (word >> 1) & valid; // axis bit of each code
+
+        y += Core::popCount64(~hi & ~lo & valid) - Core::popCount64(~hi & lo);
+        x += Core::popCount64(hi & ~lo & valid) - Core::popCount64(hi & lo);
+        i += take;
+    }
+    return Vec2(x, y);
+}
+
+} // namespace EchoDrift::Entities
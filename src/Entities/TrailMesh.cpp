@@ -0,0 +1,86 @@
+#include "Entities/TrailMesh.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace EchoDrift::Entities {
+
+namespace {
+
+int sign(int value) { return (value > 0) - (value < 0); }
+
+// True if b -> c continues in the same direction as a -> b.
+bool isStraight(const Vec2& a, const Vec2& b, const Vec2& c) {
+    return sign(b.x - a.x) == sign(c.x - b.x) && sign(b.y - a.y) == sign(c.y - b.y);
+}
+
+GLubyte toUnorm8(float value) {
+    return static_cast<GLubyte>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+} // namespace
+
+TrailMesh::TrailMesh(EchoDrift::Rendering::TrailBatch& batch, float r, float g, float b)
+    : m_batch(batch), m_range(batch.CreateRange()), m_color{toUnorm8(r), toUnorm8(g), toUnorm8(b), 255} {}
+
+TrailMesh::~TrailMesh() {
+    m_batch.DestroyRange(m_range);
+}
+
+EchoDrift::Rendering::TrailVertex TrailMesh::makeVertex(const Corner& corner) const {
+    EchoDrift::Rendering::TrailVertex vertex;
+    vertex.cell[0] = static_cast<GLushort>(corner.cell.x);
+    vertex.cell[1] = static_cast<GLushort>(corner.cell.y);
+    std::copy(std::begin(m_color), std::end(m_color), vertex.color);
+    vertex.tick = corner.tick;
+    return vertex;
+}
+
+void TrailMesh::uploadCorner(GLsizei index) {
+    // Overwrite that one vertex with its grid cell and tick.
+    m_batch.UpdateVertex(m_range, index, makeVertex(m_corners[index]));
+}
+
+void TrailMesh::AppendCell(const Vec2& cell, std::uint64_t tick) {
+    const std::size_t count = m_corners.size();
+    const Corner head{cell, static_cast<GLuint>(tick)};
+
+    // Still going straight: the head vertex just moves forward.
+    if (count >= 2 && isStraight(m_corners[count - 2].cell, m_corners[count - 1].cell, cell)) {
+        m_corners.back() = head;
+        uploadCorner(static_cast<GLsizei>(count - 1));
+        return;
+    }
+
+    // A turn (or the very first cells): the old head stays as a corner.
+    m_corners.push_back(head);
+    m_batch.Append(m_range, makeVertex(head));
+}
+
+void TrailMesh::ExpireTail(const Vec2& newTail) {
+    if (m_corners.empty()) return;
+
+    // Tail caught up with the next corner: that corner is the new tail vertex.
+    if (m_corners.size() >= 2 && m_corners[1].cell == newTail) {
+        m_corners.pop_front();
+        m_batch.DropFront(m_range, 1);
+        return;
+    }
+
+    // Otherwise slide the tail vertex along its segment. The log keeps no
+    // ticks, so the new tail's tick is interpolated between the segment's
+    // ends (exact while the entity moved every tick).
+    Corner& tail = m_corners.front();
+    if (m_corners.size() >= 2) {
+        const Corner& next = m_corners[1];
+        const int length = std::abs(next.cell.x - tail.cell.x) + std::abs(next.cell.y - tail.cell.y);
+        const int moved = std::abs(newTail.x - tail.cell.x) + std::abs(newTail.y - tail.cell.y);
+        if (length > 0) {
+            const std::uint64_t span = next.tick - tail.tick; // Modulo 2^32, like the shader
+            tail.tick += static_cast<GLuint>(span * static_cast<std::uint64_t>(moved) / static_cast<std::uint64_t>(length));
+        }
+    }
+    tail.cell = newTail;
+    uploadCorner(0);
+}
+
+} // namespace EchoDrift::Entities
@@ -1,6 +1,8 @@
 #include "Game/Grid.h"
+#include "Rendering/Renderer.h"
 #include <vector>
 #include <iostream>
+#include <algorithm>
 
 namespace EchoDrift::Game {
 
@@ -8,17 +10,22 @@ namespace EchoDrift::Game {
 // Constructor and Destructor
 // -------------------------------------------------------------------------
 
-Grid::Grid(int width, int height, float cellSize) 
+Grid::Grid(int width, int height, float cellSize, GridRenderMode renderMode) 
     // Initialization List: Encapsulating the dimensions.
     : m_width(width), 
       m_height(height), 
-      m_cellSize(cellSize) 
+      m_cellSize(cellSize),
+      m_renderMode(renderMode),
+      m_occupancy(width, height)
 {
-    // 1. Create the buffer instance (Composition)
-    m_buffer = std::make_unique<EchoDrift::Rendering::Buffer>();
-    
-    // 2. Setup the geometry
-    setupBuffers();
+    // The procedural grid is drawn entirely by the shader: no geometry at all.
+    if (m_renderMode == GridRenderMode::LINES) {
+        // 1. Create the buffer instance (Composition)
+        m_buffer = std::make_unique<EchoDrift::Rendering::Buffer>();
+        
+        // 2. Setup the geometry
+        setupBuffers();
+    }
     std::cout << "Grid created with dimensions: " << m_width << "x" << m_height << std::endl;
     // We will call setupBuffers() here later.
 }
@@ -27,6 +34,10 @@ Grid::~Grid() {
     // We will clean up m_VAO and m_VBO here later (RAII).
 }
 
+void Grid::clearOwners() {
+    m_occupancy.clear();
+}
+
 // -------------------------------------------------------------------------
 // Coordinate Mapping (The Core Logic)
 // -------------------------------------------------------------------------
@@ -52,6 +63,12 @@ Vec2 Grid::gridToScreen(const Vec2& gridPos) const {
     return Vec2(screenX, screenY);
 }
 
+void Grid::gridToScreen(float gridX, float gridY, float& screenX, float& screenY) const {
+    // Same cell-center mapping as above, without rounding to integers.
+    screenX = ((gridX + 0.5f) / static_cast<float>(m_width)) * 2.0f - 1.0f;
+    screenY = ((gridY + 0.5f) / static_cast<float>(m_height)) * 2.0f - 1.0f;
+}
+
 void Grid::setupBuffers() {
     std::vector<float> vertices;
 
@@ -3454,17 +3471,22 @@ void Grid::setupBuffers() {
     std::cout << "Grid buffers populated with " << m_buffer->getVertexCount() << " vertices." << std::endl;
 }
 
-void Grid::Render() {
-    // 1. Bind the buffer (Restores the VAO/VBO/Attribute state)
-    m_buffer->Bind();
+void Grid::Render(EchoDrift::Rendering::Renderer& renderer) const {
+    if (m_renderMode == GridRenderMode::PROCEDURAL) {
+        // One fullscreen triangle; the grid shader finds the lines per pixel.
+        renderer.DrawFullscreen(*renderer.getGridShader(),
+                                0.1f, 0.1f, 0.3f, // Faint blue grid lines
+                                EchoDrift::Rendering::RenderPass::BACKGROUND);
+        return;
+    }
 
-    // 2. Draw the lines
+    // Draw the lines
     // We are drawing a series of separate lines (GL_LINES). 
     // Total lines: (W+1) + (H+1). Vertices: 2 * Total lines.
-    glDrawArrays(GL_LINES, 0, m_buffer->getVertexCount());
-    
-    // 3. Unbind
-    m_buffer->Unbind();
+    // Recorded in the background pass, so it sorts before trails and heads.
+    renderer.Draw(*m_buffer, *renderer.getDefaultShader(),
+                  0.1f, 0.1f, 0.3f, // Faint blue grid lines
+                  GL_LINES, EchoDrift::Rendering::RenderPass::BACKGROUND);
 }
 
 } // namespace EchoDrift::Game
\ No newline at end of file
@@ -0,0 +1,160 @@
+#include "Game/MoveValidator.h"
+
+// The AVX2 kernel is compiled for x86 with GCC/Clang (per-function target
+// attribute) or MSVC (intrinsics always available); anything else gets the
+// scalar kernel only.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define ECHODRIFT_HAS_AVX2_KERNEL 1
+    #define ECHODRIFT_TARGET_AVX2 __attribute__((target("avx2")))
+    #include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #define ECHODRIFT_HAS_AVX2_KERNEL 1
+    #define ECHODRIFT_TARGET_AVX2
+    #include <immintrin.h>
+    #include <intrin.h>
+#endif
+
+namespace EchoDrift::Game {
+
+namespace {
+
+constexpr int TILE_SHIFT = SparseOccupancy::TILE_SHIFT;
+constexpr int TILE_MASK = SparseOccupancy::TILE_MASK;
+
+using KernelFn = void (*)(const SparseOccupancy&, const std::int32_t*, const std::int32_t*, EntityId*, std::size_t);
+
+// ------------------------------------------------------------------
+// Scalar Kernel (Reference + Fallback)
+// ------------------------------------------------------------------
+
+void validateScalar(const SparseOccupancy& occupancy,
+                    const std::int32_t* xs, const std::int32_t* ys, EntityId* out, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        // isInBounds() folds "x < 0" and "x >= width" into one unsigned compare.
+        out[i] = occupancy.isInBounds(xs[i], ys[i]) ? occupancy.getOwner(xs[i], ys[i]) : WALL_OWNER;
+    }
+}
+
+#ifdef ECHODRIFT_HAS_AVX2_KERNEL
+
+// ------------------------------------------------------------------
+// AVX2 Kernel: 8 candidates per iteration
+// ------------------------------------------------------------------
+
+// Gathers the owners of four cells whose tile pointers are in vTiles (one per
+// 64-bit lane) and whose in-tile indices are in vCells. Lanes outside inBounds
+// are not read and keep WALL_OWNER.
+ECHODRIFT_TARGET_AVX2
+__m128i gatherOwners4(__m256i vTiles, __m128i vCells, __m128i inBounds) {
+    // Absolute address of each owner slot: tile pointer + 2 bytes per cell.
+    const __m256i address = _mm256_add_epi64(vTiles, _mm256_slli_epi64(_mm256_cvtepu32_epi64(vCells), 1));
+    // Read 32 bits at each 16-bit slot; every owner array has one padding entry,
+    // so the last cell's read stays inside it.
+    return _mm256_mask_i64gather_epi32(_mm_set1_epi32(WALL_OWNER), nullptr, address, inBounds, 1);
+}
+
+ECHODRIFT_TARGET_AVX2
+void validateAVX2(const SparseOccupancy& occupancy,
+                  const std::int32_t* xs, const std::int32_t* ys, EntityId* out, std::size_t count) {
+    const __m256i vWidth  = _mm256_set1_epi32(occupancy.getWidth());
+    const __m256i vHeight = _mm256_set1_epi32(occupancy.getHeight());
+    const __m256i vTilesX = _mm256_set1_epi32(occupancy.getTilesX());
+    const __m256i vMinus1 = _mm256_set1_epi32(-1);
+    const __m256i vMask   = _mm256_set1_epi32(TILE_MASK);
+    const __m256i vLow16  = _mm256_set1_epi32(0xFFFF);
+    const long long* tileTable = reinterpret_cast<const long long*>(occupancy.getTileOwners());
+
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i vx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(xs + i));
+        const __m256i vy = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ys + i));
+
+        // inBounds = (x > -1) & (width > x) & (y > -1) & (height > y)
+        __m256i inBounds = _mm256_and_si256(_mm256_cmpgt_epi32(vx, vMinus1), _mm256_cmpgt_epi32(vWidth, vx));
+        inBounds = _mm256_and_si256(inBounds, _mm256_cmpgt_epi32(vy, vMinus1));
+        inBounds = _mm256_and_si256(inBounds, _mm256_cmpgt_epi32(vHeight, vy));
+
+        // Which tile each cell is in, and where inside it.
+        const __m256i tileIndex = _mm256_add_epi32(
+            _mm256_mullo_epi32(_mm256_srai_epi32(vy, TILE_SHIFT), vTilesX), _mm256_srai_epi32(vx, TILE_SHIFT));
+        const __m256i cellIndex = _mm256_or_si256(
+            _mm256_slli_epi32(_mm256_and_si256(vy, vMask), TILE_SHIFT), _mm256_and_si256(vx, vMask));
+
+        // Gather the tile pointers (never null: unwritten tiles share an
+        // all-empty array), four per 64-bit gather, then the owners through them.
+        // Out-of-bounds lanes are masked off in both gathers.
+        const __m128i boundsLo = _mm256_castsi256_si128(inBounds);
+        const __m128i boundsHi = _mm256_extracti128_si256(inBounds, 1);
+        const __m256i tilesLo = _mm256_mask_i32gather_epi64(_mm256_setzero_si256(), tileTable,
+            _mm256_castsi256_si128(tileIndex), _mm256_cvtepi32_epi64(boundsLo), 8);
+        const __m256i tilesHi = _mm256_mask_i32gather_epi64(_mm256_setzero_si256(), tileTable,
+            _mm256_extracti128_si256(tileIndex, 1), _mm256_cvtepi32_epi64(boundsHi), 8);
+
+        const __m128i ownersLo = gatherOwners4(tilesLo, _mm256_castsi256_si128(cellIndex), boundsLo);
+        const __m128i ownersHi = gatherOwners4(tilesHi, _mm256_extracti128_si256(cellIndex, 1), boundsHi);
+        __m256i result = _mm256_inserti128_si256(_mm256_castsi128_si256(ownersLo), ownersHi, 1);
+        result = _mm256_and_si256(result, vLow16); // Keep the low 16 bits (WALL_OWNER survives)
+
+        // Narrow 8 x 32-bit to 8 x 16-bit: pack within lanes, then pull the two halves together.
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(result, result), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_castsi256_si128(packed));
+    }
+
+    // Tail (fewer than 8 left)
+    validateScalar(occupancy, xs + i, ys + i, out + i, count - i);
+}
+
+// Runtime check: the CPU has AVX2 and the OS saves the YMM registers.
+bool cpuSupportsAVX2() {
+#if defined(__GNUC__)
+    return __builtin_cpu_supports("avx2");
+#else
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) return false;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#endif
+}
+
+#endif // ECHODRIFT_HAS_AVX2_KERNEL
+
+// Picks the kernel once, the first time it is needed.
+KernelFn selectKernel() {
+#ifdef ECHODRIFT_HAS_AVX2_KERNEL
+    if (cpuSupportsAVX2()) {
+        return validateAVX2;
+    }
+#endif
+    return validateScalar;
+}
+
+KernelFn activeKernel() {
+    static const KernelFn kernel = selectKernel();
+    return kernel;
+}
+
+} // namespace
+
+void MoveValidator::Validate(const Grid& grid, MoveBatch& batch) {
+    batch.owners.resize(batch.size());
+    if (batch.size() == 0) return;
+
+    activeKernel()(grid.getOccupancy(), batch.x.data(), batch.y.data(), batch.owners.data(), batch.size());
+}
+
+bool MoveValidator::usingAVX2() {
+#ifdef ECHODRIFT_HAS_AVX2_KERNEL
+    return activeKernel() == validateAVX2;
+#else
+    return false;
+#endif
+}
+
+} // namespace EchoDrift::Game
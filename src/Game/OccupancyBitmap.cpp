@@ -0,0 +1,29 @@
+#include "Game/OccupancyBitmap.h"
+
+namespace EchoDrift::Game {
+
+void OccupancyBitmap::resize(int width, int height) {
+    m_width = width;
+    m_height = height;
+    m_stride = width + 2;
+    clear();
+}
+
+void OccupancyBitmap::clear() {
+    // Total bits = (width + 2) * (height + 2), rounded up to whole 64-bit words.
+    const std::size_t totalBits = static_cast<std::size_t>(m_stride) * static_cast<std::size_t>(m_height + 2);
+    m_words.assign((totalBits + 63) / 64, 0);
+
+    // Solid border: bottom and top rows...
+    for (int x = -1; x <= m_width; ++x) {
+        setBit(bitIndex(x, -1));
+        setBit(bitIndex(x, m_height));
+    }
+    // ...and the left and right columns.
+    for (int y = 0; y < m_height; ++y) {
+        setBit(bitIndex(-1, y));
+        setBit(bitIndex(m_width, y));
+    }
+}
+
+} // namespace EchoDrift::Game
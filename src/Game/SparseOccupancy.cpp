@@ -0,0 +1,140 @@
+#include "Game/SparseOccupancy.h"
+#include "Core/BitOps.h"
+
+namespace EchoDrift::Game {
+
+namespace {
+
+// Mask with bits [lo, hi] set (0 <= lo <= hi <= 63).
+std::uint64_t bitRange(int lo, int hi) {
+    const std::uint64_t upTo = (hi == 63) ? ~std::uint64_t{0} : ((std::uint64_t{1} << (hi + 1)) - 1);
+    return upTo & (~std::uint64_t{0} << lo);
+}
+
+} // namespace
+
+const SparseOccupancy::OwnerArray SparseOccupancy::s_emptyOwners{};
+
+// -------------------------------------------------------------------------
+// Setup
+// -------------------------------------------------------------------------
+
+void SparseOccupancy::resize(int width, int height) {
+    m_width = width;
+    m_height = height;
+    m_tilesX = (width + TILE_MASK) >> TILE_SHIFT;
+    m_tilesY = (height + TILE_MASK) >> TILE_SHIFT;
+    m_summaryStride = (m_tilesX + 63) >> 6;
+    clear();
+}
+
+void SparseOccupancy::clear() {
+    m_tiles.clear();
+    m_tiles.resize(static_cast<std::size_t>(m_tilesX) * m_tilesY);
+    m_tileOwners.assign(m_tiles.size(), s_emptyOwners.data());
+    m_summary.assign(static_cast<std::size_t>(m_summaryStride) * m_tilesY, 0);
+}
+
+// -------------------------------------------------------------------------
+// Point Updates
+// -------------------------------------------------------------------------
+
+void SparseOccupancy::setSummaryBit(int tx, int ty, bool value) {
+    std::uint64_t& word = m_summary[static_cast<std::size_t>(ty) * m_summaryStride + (tx >> 6)];
+    const std::uint64_t bit = std::uint64_t{1} << (tx & 63);
+    word = value ? (word | bit) : (word & ~bit);
+}
+
+SparseOccupancy::Tile& SparseOccupancy::tileForWrite(int tx, int ty) {
+    std::unique_ptr<Tile>& tile = m_tiles[tileIndex(tx, ty)];
+    if (!tile) {
+        tile = std::make_unique<Tile>(); // Allocate on first claim
+        m_tileOwners[tileIndex(tx, ty)] = tile->owners.data();
+    }
+    return *tile;
+}
+
+void SparseOccupancy::setOwner(int x, int y, EchoDrift::Entities::EntityId owner) {
+    if (!isInBounds(x, y)) return;
+
+    const int tx = x >> TILE_SHIFT;
+    const int ty = y >> TILE_SHIFT;
+    if (owner == NO_OWNER && !m_tiles[tileIndex(tx, ty)]) return; // Already free
+
+    Tile& tile = tileForWrite(tx, ty);
+    tile.owners[cellIndex(x, y)] = owner;
+
+    std::uint64_t& row = tile.rows[y & TILE_MASK];
+    const std::uint64_t bit = std::uint64_t{1} << (x & TILE_MASK);
+    const bool wasOccupied = (row & bit) != 0;
+    const bool occupied = owner != NO_OWNER;
+    if (wasOccupied == occupied) return;
+
+    if (occupied) {
+        row |= bit;
+        if (tile.count++ == 0) setSummaryBit(tx, ty, true);
+    } else {
+        row &= ~bit;
+        if (--tile.count == 0) setSummaryBit(tx, ty, false);
+    }
+}
+
+// -------------------------------------------------------------------------
+// Region Queries
+// -------------------------------------------------------------------------
+
+bool SparseOccupancy::isRectEmpty(int x, int y, int w, int h) const {
+    if (w <= 0 || h <= 0) return true;
+    if (x < 0 || y < 0 || x + w > m_width || y + h > m_height) return false;
+
+    const int x1 = x + w - 1;
+    const int y1 = y + h - 1;
+    const int tx0 = x >> TILE_SHIFT, tx1 = x1 >> TILE_SHIFT;
+    const int ty0 = y >> TILE_SHIFT, ty1 = y1 >> TILE_SHIFT;
+
+    for (int ty = ty0; ty <= ty1; ++ty) {
+        const std::uint64_t* summaryRow = &m_summary[static_cast<std::size_t>(ty) * m_summaryStride];
+
+        // Rows of this tile that fall inside the rectangle.
+        const int rowLo = (ty == ty0) ? (y & TILE_MASK) : 0;
+        const int rowHi = (ty == ty1) ? (y1 & TILE_MASK) : TILE_MASK;
+
+        // Walk the summary words covering [tx0, tx1]; empty tiles cost nothing.
+        for (int wordIdx = tx0 >> 6; wordIdx <= (tx1 >> 6); ++wordIdx) {
+            const int lo = (wordIdx == (tx0 >> 6)) ? (tx0 & 63) : 0;
+            const int hi = (wordIdx == (tx1 >> 6)) ? (tx1 & 63) : 63;
+            std::uint64_t occupied = summaryRow[wordIdx] & bitRange(lo, hi);
+
+            while (occupied) {
+                const int tx = (wordIdx << 6) + Core::countTrailingZeros64(occupied);
+                occupied &= occupied - 1;
+
+                // Columns of this tile that fall inside the rectangle.
+                const int colLo = (tx == tx0) ? (x & TILE_MASK) : 0;
+                const int colHi = (tx == tx1) ? (x1 & TILE_MASK) : TILE_MASK;
+
+                // A non-empty tile fully inside the rectangle settles it immediately.
+                if (colLo == 0 && colHi == TILE_MASK && rowLo == 0 && rowHi == TILE_MASK) {
+                    return false;
+                }
+
+                const Tile& tile = *m_tiles[tileIndex(tx, ty)];
+                const std::uint64_t colMask = bitRange(colLo, colHi);
+                for (int r = rowLo; r <= rowHi; ++r) {
+                    if (tile.rows[r] & colMask) return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+std::size_t SparseOccupancy::getAllocatedTileCount() const {
+    std::size_t count = 0;
+    for (const auto& tile : m_tiles) {
+        if (tile) ++count;
+    }
+    return count;
+}
+
+} // namespace EchoDrift::Game
@@ -0,0 +1,128 @@
+#include "Rendering/BloomPass.h"
+#include "Rendering/GLStateCache.h"
+#include "Rendering/GpuTimer.h"
+
+namespace EchoDrift::Rendering {
+
+namespace {
+
+struct BloomTier {
+    int levels;         // Length of the blur chain
+    int startDivisor;   // First level = scene size / startDivisor
+};
+
+BloomTier tierFor(BloomQuality quality) {
+    switch (quality) {
+        case BloomQuality::LOW:    return {3, 4};
+        case BloomQuality::MEDIUM: return {4, 2};
+        case BloomQuality::HIGH:   return {6, 2};
+        case BloomQuality::OFF:    break;
+    }
+    return {0, 1};
+}
+
+} // namespace
+
+// ------------------------------------------------------------------
+// Constructor/Destructor (RAII)
+// ------------------------------------------------------------------
+
+BloomPass::BloomPass()
+    : m_downShader(std::make_unique<Shader>("fullscreen.vert", "bloom_down.frag")),
+      m_upShader(std::make_unique<Shader>("fullscreen.vert", "bloom_up.frag")),
+      m_compositeShader(std::make_unique<Shader>("fullscreen.vert", "bloom_composite.frag")) {
+    // Resolve the per-draw uniforms once; samplers never change units.
+    m_downHalfPixel = m_downShader->getUniformVec2("uHalfPixel");
+    m_downThreshold = m_downShader->getUniformFloat("uThreshold");
+    m_upHalfPixel = m_upShader->getUniformVec2("uHalfPixel");
+    m_compositeIntensity = m_compositeShader->getUniformFloat("uIntensity");
+
+    m_downShader->Use();
+    m_downShader->setUniform(m_downShader->getUniformInt("uSource"), 0);
+    m_upShader->Use();
+    m_upShader->setUniform(m_upShader->getUniformInt("uSource"), 0);
+    m_compositeShader->Use();
+    m_compositeShader->setUniform(m_compositeShader->getUniformInt("uScene"), 0);
+    m_compositeShader->setUniform(m_compositeShader->getUniformInt("uBloom"), 1);
+
+    glGenVertexArrays(1, &m_emptyVAO);
+}
+
+BloomPass::~BloomPass() {
+    if (m_emptyVAO) GLStateCache::GetInstance().DeleteVertexArray(m_emptyVAO);
+}
+
+// ------------------------------------------------------------------
+// Levels
+// ------------------------------------------------------------------
+
+void BloomPass::resizeLevels(GLsizei sceneWidth, GLsizei sceneHeight) {
+    const BloomTier tier = tierFor(m_quality);
+    while (static_cast<int>(m_levels.size()) < tier.levels) {
+        m_levels.push_back(std::make_unique<RenderTarget>(GL_RGBA16F));
+    }
+    m_levels.resize(static_cast<std::size_t>(tier.levels)); // Dropping a tier frees its levels
+
+    GLsizei width = sceneWidth / tier.startDivisor;
+    GLsizei height = sceneHeight / tier.startDivisor;
+    for (auto& level : m_levels) {
+        level->Resize(width, height); // No-op unless the window or tier changed
+        width /= 2;
+        height /= 2;
+    }
+}
+
+void BloomPass::blit(const Shader& shader, UniformVec2 halfPixel, GLuint source, const RenderTarget& target) const {
+    target.Bind();
+    glBindTexture(GL_TEXTURE_2D, source);
+    shader.setUniform(halfPixel, 0.5f / static_cast<float>(target.getWidth()),
+                      0.5f / static_cast<float>(target.getHeight()));
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+// ------------------------------------------------------------------
+// Execution (GL thread)
+// ------------------------------------------------------------------
+
+void BloomPass::Execute(GpuTimer& timer, const RenderTarget& scene, GLsizei outputWidth, GLsizei outputHeight) {
+    resizeLevels(scene.getWidth(), scene.getHeight());
+    if (m_levels.empty()) return;
+
+    GLStateCache& state = GLStateCache::GetInstance();
+    state.BindVertexArray(m_emptyVAO);
+    glActiveTexture(GL_TEXTURE0);
+
+    // 1. Down: bright pass into the first level, then halve level by level
+    timer.BeginPass("bloom down");
+    state.SetBlend(false);
+    m_downShader->Use();
+    m_downShader->setUniform(m_downThreshold, m_threshold);
+    blit(*m_downShader, m_downHalfPixel, scene.getTexture(), *m_levels[0]);
+    m_downShader->setUniform(m_downThreshold, 0.0f);
+    for (std::size_t i = 1; i < m_levels.size(); ++i) {
+        blit(*m_downShader, m_downHalfPixel, m_levels[i - 1]->getTexture(), *m_levels[i]);
+    }
+
+    // 2. Up: add each level onto the next larger one
+    timer.BeginPass("bloom up");
+    state.SetBlend(true);
+    state.BlendFunc(GL_ONE, GL_ONE);
+    m_upShader->Use();
+    for (std::size_t i = m_levels.size() - 1; i > 0; --i) {
+        blit(*m_upShader, m_upHalfPixel, m_levels[i]->getTexture(), *m_levels[i - 1]);
+    }
+
+    // 3. Composite into the window (overwrites, so no blending)
+    timer.BeginPass("bloom composite");
+    state.SetBlend(false);
+    RenderTarget::BindDefault(outputWidth, outputHeight);
+    m_compositeShader->Use();
+    m_compositeShader->setUniform(m_compositeIntensity, m_intensity);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, m_levels[0]->getTexture());
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, scene.getTexture());
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+} // namespace EchoDrift::Rendering
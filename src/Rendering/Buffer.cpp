@@ -17,8 +17,8 @@ Buffer::Buffer() {
 
 Buffer::~Buffer() {
     // Clean up the OpenGL resources
-    if (m_VAO) glDeleteVertexArrays(1, &m_VAO);
-    if (m_VBO) glDeleteBuffers(1, &m_VBO);
+    if (m_VAO) GLStateCache::GetInstance().DeleteVertexArray(m_VAO);
+    if (m_VBO) GLStateCache::GetInstance().DeleteBuffer(m_VBO);
     // std::cout << "Buffer destroyed." << std::endl;
 }
 
@@ -35,7 +35,7 @@ void Buffer::SetData(const std::vector<float>& vertices) {
     
     // 2. Bind the VAO and VBO
     Bind(); // Binds m_VAO
-    glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, m_VBO);
     
     // 3. Upload the data from CPU to GPU
     // GL_STATIC_DRAW means the data won't change often (good for our Grid).
@@ -54,7 +54,7 @@ void Buffer::SetData(const std::vector<float>& vertices) {
     glEnableVertexAttribArray(0);
     
     // 6. Unbind (optional, but good practice)
-    glBindBuffer(GL_ARRAY_BUFFER, 0); // Unbind VBO first
+    GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, 0); // Unbind VBO first
     Unbind();                         // Unbind VAO last
 }
 
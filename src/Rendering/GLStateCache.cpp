@@ -0,0 +1,111 @@
+#include "Rendering/GLStateCache.h"
+
+namespace EchoDrift::Rendering {
+
+GLStateCache& GLStateCache::GetInstance() {
+    // One GL context, one cache.
+    static GLStateCache instance;
+    return instance;
+}
+
+int GLStateCache::slotFor(GLenum target) {
+    switch (target) {
+        case GL_ARRAY_BUFFER:      return ARRAY;
+        case GL_COPY_READ_BUFFER:  return COPY_READ;
+        case GL_COPY_WRITE_BUFFER: return COPY_WRITE;
+        case GL_UNIFORM_BUFFER:    return UNIFORM;
+        default:                   return -1;
+    }
+}
+
+// ------------------------------------------------------------------
+// Bindings
+// ------------------------------------------------------------------
+
+void GLStateCache::UseProgram(GLuint program) {
+    if (issue(m_program != program)) {
+        glUseProgram(program);
+        m_program = program;
+    }
+}
+
+void GLStateCache::BindVertexArray(GLuint vertexArray) {
+    if (issue(m_vertexArray != vertexArray)) {
+        glBindVertexArray(vertexArray);
+        m_vertexArray = vertexArray;
+    }
+}
+
+void GLStateCache::BindBuffer(GLenum target, GLuint buffer) {
+    const int slot = slotFor(target);
+    if (slot < 0) {
+        ++m_issuedCalls;
+        glBindBuffer(target, buffer);
+        return;
+    }
+    if (issue(m_buffers[slot] != buffer)) {
+        glBindBuffer(target, buffer);
+        m_buffers[slot] = buffer;
+    }
+}
+
+// ------------------------------------------------------------------
+// Fixed-Function State
+// ------------------------------------------------------------------
+
+void GLStateCache::SetBlend(bool enabled) {
+    if (issue(m_blendEnabled != static_cast<int>(enabled))) {
+        if (enabled) glEnable(GL_BLEND); else glDisable(GL_BLEND);
+        m_blendEnabled = enabled;
+    }
+}
+
+void GLStateCache::BlendFunc(GLenum sourceFactor, GLenum destFactor) {
+    if (issue(!m_blendFuncKnown || m_blendSource != sourceFactor || m_blendDest != destFactor)) {
+        glBlendFunc(sourceFactor, destFactor);
+        m_blendSource = sourceFactor;
+        m_blendDest = destFactor;
+        m_blendFuncKnown = true;
+    }
+}
+
+void GLStateCache::LineWidth(float width) {
+    if (issue(!m_lineWidthKnown || m_lineWidth != width)) {
+        glLineWidth(width);
+        m_lineWidth = width;
+        m_lineWidthKnown = true;
+    }
+}
+
+// ------------------------------------------------------------------
+// Object Lifetime
+// ------------------------------------------------------------------
+
+// GL unbinds a deleted object, and may hand its name out again.
+void GLStateCache::DeleteProgram(GLuint program) {
+    glDeleteProgram(program);
+    if (m_program == program) m_program = UNKNOWN; // Stays current until replaced
+}
+
+void GLStateCache::DeleteVertexArray(GLuint vertexArray) {
+    glDeleteVertexArrays(1, &vertexArray);
+    if (m_vertexArray == vertexArray) m_vertexArray = 0;
+}
+
+void GLStateCache::DeleteBuffer(GLuint buffer) {
+    glDeleteBuffers(1, &buffer);
+    for (GLuint& bound : m_buffers) {
+        if (bound == buffer) bound = 0;
+    }
+}
+
+void GLStateCache::Invalidate() {
+    m_program = UNKNOWN;
+    m_vertexArray = UNKNOWN;
+    for (GLuint& bound : m_buffers) bound = UNKNOWN;
+    m_blendEnabled = -1;
+    m_blendFuncKnown = false;
+    m_lineWidthKnown = false;
+}
+
+} // namespace EchoDrift::Rendering
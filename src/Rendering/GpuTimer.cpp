@@ -0,0 +1,101 @@
+#include "Rendering/GpuTimer.h"
+
+namespace EchoDrift::Rendering {
+
+// ------------------------------------------------------------------
+// Constructor/Destructor (RAII)
+// ------------------------------------------------------------------
+
+GpuTimer::GpuTimer() {
+    for (Slot& slot : m_slots) {
+        glGenQueries(MAX_PASSES, slot.queries);
+    }
+}
+
+GpuTimer::~GpuTimer() {
+    for (Slot& slot : m_slots) {
+        glDeleteQueries(MAX_PASSES, slot.queries);
+    }
+}
+
+// ------------------------------------------------------------------
+// Recording (GL thread)
+// ------------------------------------------------------------------
+
+void GpuTimer::BeginFrame() {
+    // Read back finished frames, oldest first (the slot about to be reused),
+    // stopping at the first one the GPU has not finished yet.
+    for (int i = 0; i < FRAME_LATENCY; ++i) {
+        Slot& slot = m_slots[(m_current + i) % FRAME_LATENCY];
+        if (slot.pending && !tryCollect(slot)) break;
+    }
+
+    // The GPU is a whole ring behind: give up on that frame instead of waiting.
+    Slot& slot = m_slots[m_current];
+    slot.pending = false;
+
+    slot.passCount = 0;
+    slot.frame = m_frameCounter++;
+}
+
+void GpuTimer::BeginPass(const char* name) {
+    EndPass();
+
+    Slot& slot = m_slots[m_current];
+    if (slot.passCount >= MAX_PASSES) return;
+
+    slot.names[slot.passCount] = name;
+    glBeginQuery(GL_TIME_ELAPSED, slot.queries[slot.passCount]);
+    ++slot.passCount;
+    m_passOpen = true;
+}
+
+void GpuTimer::EndPass() {
+    if (!m_passOpen) return;
+    glEndQuery(GL_TIME_ELAPSED);
+    m_passOpen = false;
+}
+
+void GpuTimer::EndFrame() {
+    EndPass();
+
+    Slot& slot = m_slots[m_current];
+    slot.pending = slot.passCount > 0;
+    m_current = (m_current + 1) % FRAME_LATENCY;
+}
+
+// ------------------------------------------------------------------
+// Read-Back
+// ------------------------------------------------------------------
+
+bool GpuTimer::tryCollect(Slot& slot) {
+    // Asking for GL_QUERY_RESULT before it is available would block.
+    for (int i = 0; i < slot.passCount; ++i) {
+        GLint available = 0;
+        glGetQueryObjectiv(slot.queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) return false;
+    }
+
+    FrameTimings timings;
+    timings.frame = slot.frame;
+    timings.passes.reserve(static_cast<std::size_t>(slot.passCount));
+    for (int i = 0; i < slot.passCount; ++i) {
+        GLuint64 nanoseconds = 0;
+        glGetQueryObjectui64v(slot.queries[i], GL_QUERY_RESULT, &nanoseconds);
+        const double milliseconds = static_cast<double>(nanoseconds) * 1e-6;
+        timings.passes.push_back({slot.names[i], milliseconds});
+        timings.totalMilliseconds += milliseconds;
+    }
+    slot.pending = false;
+
+    std::lock_guard<std::mutex> lock(m_resultsMutex);
+    m_latest = std::move(timings);
+    return true;
+}
+
+GpuTimer::FrameTimings GpuTimer::getLatest() const {
+    std::lock_guard<std::mutex> lock(m_resultsMutex);
+    return m_latest;
+}
+
+} // namespace EchoDrift::Rendering
@@ -0,0 +1,173 @@
+#include "Rendering/ProgramBinaryCache.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace EchoDrift::Rendering {
+
+namespace {
+
+constexpr std::uint32_t FILE_MAGIC = 0x42504445u; // "EDPB"
+constexpr std::uint32_t FILE_VERSION = 1;
+// Real program binaries are tens to hundreds of KiB; anything past this is
+// a corrupt header, not something worth allocating for.
+constexpr std::uint32_t MAX_BINARY_LENGTH = 64u * 1024u * 1024u;
+
+// What precedes the binary in each cache file.
+struct FileHeader {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint64_t key;     // Guards against a renamed/colliding file
+    std::uint32_t format;  // GLenum from glGetProgramBinary
+    std::uint32_t length;  // Bytes of binary that follow
+};
+
+// 64-bit FNV-1a, continued from hash.
+std::uint64_t hashBytes(std::uint64_t hash, const std::string& bytes) {
+    for (unsigned char byte : bytes) {
+        hash ^= byte;
+        hash *= 0x100000001B3ull;
+    }
+    // Length too, so "ab" + "c" and "a" + "bc" differ.
+    hash ^= bytes.size();
+    hash *= 0x100000001B3ull;
+    return hash;
+}
+
+std::string glString(GLenum name) {
+    const GLubyte* value = glGetString(name);
+    return value ? reinterpret_cast<const char*>(value) : "";
+}
+
+} // namespace
+
+ProgramBinaryCache& ProgramBinaryCache::GetInstance() {
+    static ProgramBinaryCache instance;
+    return instance;
+}
+
+bool ProgramBinaryCache::isSupported() {
+    if (m_supported < 0) {
+        GLint formats = 0;
+        if (GLEW_VERSION_4_1 || GLEW_ARB_get_program_binary) {
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        }
+        m_supported = formats > 0 ? 1 : 0;
+    }
+    return m_supported == 1;
+}
+
+std::uint64_t ProgramBinaryCache::MakeKey(const std::string& vertexSource, const std::string& fragmentSource) {
+    if (m_driver.empty()) {
+        m_driver = glString(GL_VENDOR) + "\n" + glString(GL_RENDERER) + "\n" + glString(GL_VERSION);
+    }
+
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    hash = hashBytes(hash, m_driver);
+    hash = hashBytes(hash, vertexSource);
+    hash = hashBytes(hash, fragmentSource);
+    return hash;
+}
+
+std::string ProgramBinaryCache::pathFor(std::uint64_t key) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+    return m_directory + "/" + name;
+}
+
+// ------------------------------------------------------------------
+// Load/Store
+// ------------------------------------------------------------------
+
+GLuint ProgramBinaryCache::Load(std::uint64_t key) {
+    if (!isSupported()) return 0;
+
+    const std::string path = pathFor(key);
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return 0; // Cold cache
+    const std::streamoff fileSize = file.tellg();
+    file.seekg(0);
+
+    FileHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    // The header must describe exactly the bytes that follow it.
+    const bool lengthOk = file && header.length > 0 && header.length <= MAX_BINARY_LENGTH &&
+                          fileSize - static_cast<std::streamoff>(sizeof(header)) ==
+                              static_cast<std::streamoff>(header.length);
+    std::vector<char> binary;
+    if (lengthOk && header.magic == FILE_MAGIC && header.version == FILE_VERSION && header.key == key) {
+        binary.resize(header.length);
+        file.read(binary.data(), static_cast<std::streamsize>(binary.size()));
+    }
+    const bool readOk = !binary.empty() && file.gcount() == static_cast<std::streamsize>(binary.size());
+    file.close();
+
+    GLuint program = 0;
+    GLint linked = GL_FALSE;
+    if (readOk) {
+        program = glCreateProgram();
+        glProgramBinary(program, static_cast<GLenum>(header.format), binary.data(), static_cast<GLsizei>(binary.size()));
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    }
+
+    if (linked != GL_TRUE) {
+        // Truncated, foreign, or the driver no longer accepts it: rebuild from source.
+        if (program) glDeleteProgram(program);
+        std::error_code ignored;
+        std::filesystem::remove(path, ignored);
+        std::cerr << "WARNING::SHADER_CACHE::BINARY_REJECTED: " << path << std::endl;
+        return 0;
+    }
+    return program;
+}
+
+void ProgramBinaryCache::PrepareForLink(GLuint program) {
+    if (isSupported()) {
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+}
+
+void ProgramBinaryCache::Store(std::uint64_t key, GLuint program) {
+    if (!isSupported()) return;
+
+    // Never cache a program that failed to compile or link.
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (linked != GL_TRUE) return;
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    std::vector<char> binary(static_cast<std::size_t>(length));
+    GLenum format = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &format, binary.data());
+    if (written <= 0) return;
+
+    std::error_code error;
+    std::filesystem::create_directories(m_directory, error);
+
+    // Write to a temporary name first: a crash mid-write must not leave a
+    // truncated file under the real key.
+    const std::string path = pathFor(key);
+    const std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        const FileHeader header{FILE_MAGIC, FILE_VERSION, key, static_cast<std::uint32_t>(format),
+                                static_cast<std::uint32_t>(written)};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(binary.data(), written);
+        if (!file) {
+            std::cerr << "WARNING::SHADER_CACHE::WRITE_FAILED: " << path << std::endl;
+            file.close();
+            std::filesystem::remove(temporary, error);
+            return;
+        }
+    }
+    std::filesystem::rename(temporary, path, error);
+}
+
+} // namespace EchoDrift::Rendering
@@ -0,0 +1,113 @@
+#include "Rendering/QuadBatch.h"
+#include "Rendering/GLStateCache.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+namespace EchoDrift::Rendering {
+
+namespace {
+
+// Initial instances per frame; the stream grows if a frame needs more.
+constexpr GLsizeiptr INITIAL_INSTANCE_CAPACITY = 1024;
+
+GLubyte toUnorm8(float value) {
+    return static_cast<GLubyte>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+} // namespace
+
+// ------------------------------------------------------------------
+// Constructor/Destructor (RAII)
+// ------------------------------------------------------------------
+
+QuadBatch::QuadBatch() : m_instanceStream(INITIAL_INSTANCE_CAPACITY * sizeof(QuadInstance)) {
+    glGenVertexArrays(1, &m_VAO);
+    glGenBuffers(1, &m_quadVBO);
+
+    // Unit quad centered on the origin, as a triangle strip.
+    const float corners[] = {
+        -0.5f, -0.5f,
+         0.5f, -0.5f,
+        -0.5f,  0.5f,
+         0.5f,  0.5f,
+    };
+    GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, m_quadVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+    GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, 0);
+
+    GLStateCache::GetInstance().BindVertexArray(m_VAO);
+    setupAttributes();
+    GLStateCache::GetInstance().BindVertexArray(0);
+}
+
+QuadBatch::~QuadBatch() {
+    if (m_VAO) GLStateCache::GetInstance().DeleteVertexArray(m_VAO);
+    if (m_quadVBO) GLStateCache::GetInstance().DeleteBuffer(m_quadVBO);
+}
+
+void QuadBatch::setupAttributes() const {
+    // layout (location = 0) in vec2 aCorner: per vertex
+    GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, m_quadVBO);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    // locations 1-3: per instance (divisor 1); pointed at the stream per draw
+    for (GLuint location = 1; location <= 3; ++location) {
+        glEnableVertexAttribArray(location);
+        glVertexAttribDivisor(location, 1);
+    }
+    GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void QuadBatch::bindInstances(GLintptr offset) const {
+    // GL 3.3 has no base instance, so the offset goes into the pointers. The
+    // caller has the VAO bound.
+    const GLsizei stride = sizeof(QuadInstance);
+    const char* base = reinterpret_cast<const char*>(offset);
+    GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, m_instanceStream.getBuffer());
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, base + offsetof(QuadInstance, center));
+    glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, base + offsetof(QuadInstance, color));
+    glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, stride, base + offsetof(QuadInstance, size));
+}
+
+// ------------------------------------------------------------------
+// Per-Frame Instances
+// ------------------------------------------------------------------
+
+void QuadBatch::Add(float x, float y, float size, float r, float g, float b) {
+    QuadInstance instance;
+    instance.center[0] = x;
+    instance.center[1] = y;
+    instance.color[0] = toUnorm8(r);
+    instance.color[1] = toUnorm8(g);
+    instance.color[2] = toUnorm8(b);
+    instance.color[3] = 255;
+    instance.size = size;
+    m_instances.push_back(instance);
+}
+
+void QuadBatch::TakeInstances(std::vector<QuadInstance>& instances) {
+    instances.swap(m_instances);
+    m_instances.clear();
+}
+
+void QuadBatch::Draw(const std::vector<QuadInstance>& instances) {
+    if (instances.empty()) return;
+
+    const GLsizei count = static_cast<GLsizei>(instances.size());
+    const GLsizeiptr bytes = count * static_cast<GLsizeiptr>(sizeof(QuadInstance));
+
+    // Straight into this frame's region: no orphaning, no extra copy in the driver.
+    GLintptr offset = 0;
+    void* data = m_instanceStream.Allocate(bytes, offset);
+    if (!data) return;
+    std::memcpy(data, instances.data(), static_cast<std::size_t>(bytes));
+    m_instanceStream.Commit();
+
+    GLStateCache::GetInstance().BindVertexArray(m_VAO);
+    bindInstances(offset);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, count);
+}
+
+} // namespace EchoDrift::Rendering
@@ -0,0 +1,56 @@
+#include "Rendering/RenderTarget.h"
+#include <iostream>
+
+namespace EchoDrift::Rendering {
+
+RenderTarget::~RenderTarget() {
+    Release();
+}
+
+void RenderTarget::Release() {
+    if (m_texture) glDeleteTextures(1, &m_texture);
+    if (m_FBO) glDeleteFramebuffers(1, &m_FBO);
+    m_texture = 0;
+    m_FBO = 0;
+    m_width = 0;
+    m_height = 0;
+}
+
+void RenderTarget::Resize(GLsizei width, GLsizei height) {
+    if (width < 1) width = 1;
+    if (height < 1) height = 1;
+    if (m_FBO && width == m_width && height == m_height) return;
+
+    if (!m_FBO) {
+        glGenFramebuffers(1, &m_FBO);
+        glGenTextures(1, &m_texture);
+    }
+    m_width = width;
+    m_height = height;
+
+    glBindTexture(GL_TEXTURE_2D, m_texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, m_internalFormat, width, height, 0, GL_RGBA, GL_FLOAT, nullptr);
+    // Bilinear filtering is what the blur and upscale shaders rely on.
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, m_FBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_texture, 0);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "ERROR::RENDER_TARGET::INCOMPLETE " << width << "x" << height << std::endl;
+    }
+}
+
+void RenderTarget::Bind() const {
+    glBindFramebuffer(GL_FRAMEBUFFER, m_FBO);
+    glViewport(0, 0, m_width, m_height);
+}
+
+void RenderTarget::BindDefault(GLsizei width, GLsizei height) {
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, width, height);
+}
+
+} // namespace EchoDrift::Rendering
@@ -0,0 +1,87 @@
+#include "Rendering/RenderThread.h"
+#include "Rendering/GLStateCache.h"
+#include <iostream>
+
+namespace EchoDrift::Rendering {
+
+// ------------------------------------------------------------------
+// Lifetime
+// ------------------------------------------------------------------
+
+void RenderThread::Start(GLFWwindow* window, ExecuteFunction execute) {
+    if (isRunning()) return;
+
+    m_window = window;
+    m_execute = std::move(execute);
+    m_quit = false;
+
+    // A context can only be current on one thread at a time.
+    glfwMakeContextCurrent(nullptr);
+    m_thread = std::thread(&RenderThread::run, this);
+
+    std::cout << "Render thread started." << std::endl;
+}
+
+void RenderThread::Stop() {
+    if (!isRunning()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+    }
+    m_condition.notify_all();
+    m_thread.join();
+
+    // Hand the context back (GL objects are destroyed on this thread).
+    glfwMakeContextCurrent(m_window);
+    GLStateCache::GetInstance().Invalidate();
+}
+
+// ------------------------------------------------------------------
+// Frame Hand-Off
+// ------------------------------------------------------------------
+
+std::unique_ptr<RenderFrame> RenderThread::Submit(std::unique_ptr<RenderFrame> frame) {
+    std::unique_ptr<RenderFrame> next;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // One frame in flight: wait until the previous one has been executed.
+        m_condition.wait(lock, [this] { return !m_pending && !m_busy; });
+        m_pending = std::move(frame);
+        next = std::move(m_spare);
+    }
+    m_condition.notify_all();
+
+    if (!next) next = std::make_unique<RenderFrame>(); // First frames
+    return next;
+}
+
+void RenderThread::run() {
+    glfwMakeContextCurrent(m_window);
+    GLStateCache::GetInstance().Invalidate();
+
+    while (true) {
+        std::unique_ptr<RenderFrame> frame;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this] { return m_pending || m_quit; });
+            if (!m_pending) break; // Quit, with nothing left to draw
+            frame = std::move(m_pending);
+            m_busy = true;
+        }
+
+        m_execute(*frame);
+        frame->Clear();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_spare = std::move(frame);
+            m_busy = false;
+        }
+        m_condition.notify_all();
+    }
+
+    glfwMakeContextCurrent(nullptr);
+}
+
+} // namespace EchoDrift::Rendering
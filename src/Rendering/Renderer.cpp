@@ -1,58 +1,364 @@
 #include "Rendering/Renderer.h"
 #include <iostream>
 #include "Rendering/Shader.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Names under which each pass shows up in the GPU timings.
+const char* passName(EchoDrift::Rendering::RenderPass pass) {
+    switch (pass) {
+        case EchoDrift::Rendering::RenderPass::BACKGROUND: return "grid";
+        case EchoDrift::Rendering::RenderPass::WORLD:      return "trails";
+        case EchoDrift::Rendering::RenderPass::OVERLAY:    return "heads";
+        case EchoDrift::Rendering::RenderPass::HUD:        return "hud";
+    }
+    return "other";
+}
+
+} // namespace
 
 namespace EchoDrift::Rendering {
 
 void Renderer::Init() {
     // This is where we would enable depth test, blending, etc.
     m_defaultShader = std::make_unique<Shader>("simple.vert", "simple.frag");
+    m_trailShader = std::make_unique<Shader>("trail.vert", "trail.frag");
+    m_trailShader->Use();
+    m_trailShader->setUniform(m_trailShader->getUniformInt("uTrailVertices"), 0); // Texture unit 0
+    m_trailShader->setUniformFloat("uTrailWidth", 0.35f); // Cells, so ribbons scale with the grid
+    m_trailShader->setUniformFloat("uFadeTicks", 120.0f);  // Age (ticks) at which a trail is fully dimmed...
+    m_trailShader->setUniformFloat("uFadeFloor", 0.35f);   // ...to this (trails are walls: never invisible)
+    m_trailShader->setUniformFloat("uPulsePeriod", 24.0f); // Ticks between pulses running down the trail
+    m_trailShader->setUniformFloat("uPulseAmount", 0.4f);  // Extra brightness at a pulse's peak
+    m_trailCurrentTick = m_trailShader->getUniformUint("uCurrentTick");
+    m_trailTickAlpha = m_trailShader->getUniformFloat("uTickAlpha");
+    m_trailPixelSize = m_trailShader->getUniformVec2("uPixelSize");
+
+    // Shared storage for all trails (entities create their ranges in it)
+    m_trailBatch = std::make_unique<TrailBatch>();
+
+    // Instanced quads (per-instance color)
+    m_quadShader = std::make_unique<Shader>("quad.vert", "quad.frag");
+    m_quadBatch = std::make_unique<QuadBatch>();
+
+    // Procedural grid: one fullscreen triangle, no vertex data
+    m_gridShader = std::make_unique<Shader>("grid.vert", "grid.frag");
+    m_gridShader->Use();
+    m_gridShader->setUniformFloat("uLineWidth", 1.5f); // Pixels, independent of resolution and grid size
+    glGenVertexArrays(1, &m_emptyVAO);
 
     // Enable Blending for transparency and glow effects
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE); // Additive blending for neon glow
+    GLStateCache& state = GLStateCache::GetInstance();
+    state.SetBlend(true);
+    state.BlendFunc(GL_SRC_ALPHA, GL_ONE); // Additive blending for neon glow
+
+    // No glLineWidth: core profiles may clamp it to 1.0, so trails are ribbons
+    // expanded in the vertex shader instead of wide lines.
 
-    // Set line width for trails (can be changed later)
-    glLineWidth(2.0f); // Make lines a bit thicker
+    // Per-pass GPU timing (GL_TIME_ELAPSED ring)
+    m_gpuTimer = std::make_unique<GpuTimer>();
+
+    // Bloom shaders now; its targets are sized on the first frame
+    m_bloom = std::make_unique<BloomPass>();
+
+    // Scene target -> window when rendering below native without bloom
+    m_upscaleShader = std::make_unique<Shader>("fullscreen.vert", "upscale.frag");
+    m_upscaleShader->Use();
+    m_upscaleShader->setUniform(m_upscaleShader->getUniformInt("uScene"), 0);
+
+    // The first frame to record into
+    m_recording = std::make_unique<RenderFrame>();
 
     std::cout << "Renderer Initialized. Shader Program Ready. Blending Enabled." << std::endl;
 }
 
+Renderer::~Renderer() {
+    // Normally a no-op: GameManager::Shutdown() already released everything.
+    Shutdown();
+}
+
+void Renderer::Shutdown() {
+    // Take the GL context back before the GL objects below are destroyed.
+    StopRenderThread();
+
+    m_recording.reset();
+    m_bloom.reset();
+    m_sceneTarget.Release();
+    m_gpuTimer.reset();
+    m_quadBatch.reset();
+    m_trailBatch.reset();
+    m_upscaleShader.reset();
+    m_quadShader.reset();
+    m_gridShader.reset();
+    m_trailShader.reset();
+    m_defaultShader.reset();
+    if (m_emptyVAO != 0) {
+        GLStateCache::GetInstance().DeleteVertexArray(m_emptyVAO);
+        m_emptyVAO = 0;
+    }
+}
+
+// ------------------------------------------------------------------
+// Render Thread
+// ------------------------------------------------------------------
+
+void Renderer::StartRenderThread(GLFWwindow* window) {
+    m_renderThread.Start(window, [this](RenderFrame& frame) { executeFrame(frame); });
+}
+
+void Renderer::StopRenderThread() {
+    m_renderThread.Stop();
+}
+
+// ------------------------------------------------------------------
+// Recording (game thread)
+// ------------------------------------------------------------------
+
 void Renderer::ClearScreen() {
     // This is the LOW-LEVEL command we are ABSTRACTION away.
     // The GameManager doesn't need to know 'glClearColor' or 'glClear'.
-    glClearColor(0.0f, 0.0f, 0.1f, 1.0f); // Dark blue for the neon look
-    glClear(GL_COLOR_BUFFER_BIT);
+    RenderCommand command;
+    command.key = MakeSortKey(RenderPass::BACKGROUND, 0, 0, 0); // Before anything else
+    command.type = RenderCommandType::CLEAR;
+    command.color[0] = 0.0f; // Dark blue for the neon look
+    command.color[1] = 0.0f;
+    command.color[2] = 0.1f;
+    m_recording->commands.push_back(command);
 }
 
-void Renderer::Draw(const Buffer& buffer, const Shader& shader, float r, float g, float b) const {
-    // 1. Activate the Shader Program
-    shader.Use(); 
-    
-    // 2. Pass the Color Uniform
-    // (We assume the shader has a uniform called "uColor" that accepts a float vector)
-    // NOTE: If you implemented a setUniformVec3 function in Shader.h/cpp, use it here!
-    // Since we only made setUniformFloat, we'll assume a vec3 uniform for colors.
-    
-    // --- TEMPORARY UNIFORM FIX ---
-    // Since we only implemented setUniformFloat, we'll call a hypothetical setUniformVec3 here.
-    // If your Shader class uses GLM or similar for Vec3, you MUST implement this function:
-    // shader.setUniformVec3("uColor", glm::vec3(r, g, b)); 
-    // For this example, we assume setUniformVec3 exists.
-    
-    // You MUST implement this function in Shader.cpp!
-    GLint colorLocation = glGetUniformLocation(shader.getProgramID(), "uColor"); 
-    glUniform3f(colorLocation, r, g, b);
-    // -----------------------------
-    
-    // 3. Bind the Geometry Data
-    buffer.Bind();
+void Renderer::Draw(const Buffer& buffer, const Shader& shader, float r, float g, float b, GLenum primitiveType,
+                    RenderPass pass, std::uint16_t depth) {
+    RenderCommand command;
+    command.key = MakeSortKey(pass, shader.getProgramID(), buffer.getVertexArrayID(), depth);
+    command.type = RenderCommandType::DRAW_ARRAYS;
+    command.primitiveType = primitiveType;
+    command.shader = &shader;
+    command.buffer = &buffer;
+    command.first = 0;
+    command.count = buffer.getVertexCount();
+    command.color[0] = r;
+    command.color[1] = g;
+    command.color[2] = b;
+    m_recording->commands.push_back(command);
+}
+
+void Renderer::DrawFullscreen(const Shader& shader, float r, float g, float b,
+                              RenderPass pass, std::uint16_t depth) {
+    RenderCommand command;
+    command.key = MakeSortKey(pass, shader.getProgramID(), m_emptyVAO, depth);
+    command.type = RenderCommandType::DRAW_FULLSCREEN;
+    command.primitiveType = GL_TRIANGLES;
+    command.shader = &shader;
+    command.count = 3;
+    command.color[0] = r;
+    command.color[1] = g;
+    command.color[2] = b;
+    m_recording->commands.push_back(command);
+}
+
+void Renderer::setGridSize(int width, int height) {
+    // Uniforms are per-program state, so this only needs setting when the grid changes.
+    m_gridWidth = std::max(width, 1);
+    m_gridHeight = std::max(height, 1);
+    m_gridShader->Use();
+    m_gridShader->setUniformVec2("uGridSize", static_cast<float>(width), static_cast<float>(height));
+    m_trailShader->Use();
+    m_trailShader->setUniformVec2("uGridSize", static_cast<float>(width), static_cast<float>(height));
+    m_quadShader->Use();
+    m_quadShader->setUniformVec2("uGridSize", static_cast<float>(width), static_cast<float>(height));
+}
 
-    // 4. Draw the Geometry
-    // We are drawing GL_LINES because the Grid setup created pairs of vertices for lines.
-    glDrawArrays(primitiveType, 0, buffer.getVertexCount()); // Use the passed primitiveType    
-    // 5. Cleanup (optional, but good practice)
-    buffer.Unbind();
+void Renderer::DrawTrails() {
+    // Colors are per vertex, so one program bind and one call covers every trail.
+    RenderCommand command;
+    command.key = MakeSortKey(RenderPass::WORLD, m_trailShader->getProgramID(), 0, 0);
+    command.type = RenderCommandType::DRAW_TRAILS;
+    m_recording->commands.push_back(command);
+}
+
+void Renderer::DrawQuads() {
+    // Heads go on top of the trails
+    RenderCommand command;
+    command.key = MakeSortKey(RenderPass::OVERLAY, m_quadShader->getProgramID(), 0, 0);
+    command.type = RenderCommandType::DRAW_QUADS;
+    m_recording->commands.push_back(command);
+}
+
+void Renderer::EndFrame(GLFWwindow* window) {
+    // Collect the batched data the commands refer to
+    RenderFrame& frame = *m_recording;
+    m_trailBatch->TakeFrame(frame.trails);
+    m_quadBatch->TakeInstances(frame.quads);
+    frame.window = window;
+    if (window) glfwGetFramebufferSize(window, &frame.width, &frame.height); // Main thread only
+    frame.bloomQuality = m_bloomQuality;
+
+    updateRenderScale();
+    frame.renderScale = m_resolutionScaler.getScale();
+    frame.tick = static_cast<std::uint32_t>(m_currentTick);
+    frame.tickAlpha = m_interpolationAlpha;
+
+    if (m_renderThread.isRunning()) {
+        // Overlap: the render thread executes this frame while we simulate the next one.
+        m_recording = m_renderThread.Submit(std::move(m_recording));
+    } else {
+        executeFrame(frame);
+        frame.Clear();
+    }
+
+    // Waiting in Submit() is not game-thread work: the next frame starts now.
+    m_frameStart = std::chrono::steady_clock::now();
+    m_frameStarted = true;
+}
+
+void Renderer::updateRenderScale() {
+    // CPU frame time: the game thread's work on this frame, or the render
+    // thread's on the previous one, whichever took longer (they overlap).
+    if (m_frameStarted) {
+        const std::chrono::duration<double, std::milli> gameTime = std::chrono::steady_clock::now() - m_frameStart;
+        m_resolutionScaler.AddCpuSample(std::max(gameTime.count(), m_executeMilliseconds.load()));
+    }
+
+    // GPU frame time: each completed frame once (it arrives a few frames late)
+    const GpuTimer::FrameTimings gpu = m_gpuTimer->getLatest();
+    if (gpu.frame != m_lastGpuFrame && !gpu.passes.empty()) {
+        m_lastGpuFrame = gpu.frame;
+        m_resolutionScaler.AddGpuSample(gpu.totalMilliseconds);
+    }
+}
+
+// ------------------------------------------------------------------
+// Execution (GL thread)
+// ------------------------------------------------------------------
+
+void Renderer::executeFrame(RenderFrame& frame) {
+    const auto executeStart = std::chrono::steady_clock::now();
+    m_gpuTimer->BeginFrame();
+
+    // 1. Bring the batched GPU data up to date (even if nothing draws it this frame)
+    m_trailBatch->Upload(frame.trails);
+
+    // Scene target: offscreen (HDR, possibly scaled) when blooming or below
+    // native resolution, otherwise the window itself
+    m_bloom->setQuality(frame.bloomQuality);
+    const bool offscreen = m_bloom->isEnabled() || frame.renderScale < 1.0f;
+    GLsizei sceneWidth = frame.width;
+    GLsizei sceneHeight = frame.height;
+    if (offscreen) {
+        m_sceneTarget.Resize(static_cast<GLsizei>(std::lround(frame.width * frame.renderScale)),
+                             static_cast<GLsizei>(std::lround(frame.height * frame.renderScale)));
+        m_sceneTarget.Bind();
+        sceneWidth = m_sceneTarget.getWidth();
+        sceneHeight = m_sceneTarget.getHeight();
+    } else {
+        RenderTarget::BindDefault(frame.width, frame.height);
+    }
+
+    // Additive blending for the scene (the bloom pass changes it)
+    GLStateCache& state = GLStateCache::GetInstance();
+    state.SetBlend(true);
+    state.BlendFunc(GL_SRC_ALPHA, GL_ONE);
+
+    // 2. Sort: pass, then program, then VAO, then depth. Stable, so equal keys
+    // keep their recording order.
+    std::stable_sort(frame.commands.begin(), frame.commands.end(),
+                     [](const RenderCommand& a, const RenderCommand& b) { return a.key < b.key; });
+
+    // 3. Execute, timing each pass (the sort keeps a pass's commands together).
+    // The scene goes to the window before the HUD, which draws at native resolution.
+    bool resolved = !offscreen;
+    int currentPass = -1;
+    for (const RenderCommand& command : frame.commands) {
+        const RenderPass pass = static_cast<RenderPass>(command.key >> 56);
+        if (static_cast<int>(pass) != currentPass) {
+            if (pass == RenderPass::HUD && !resolved) {
+                resolveScene(frame);
+                resolved = true;
+            }
+            m_gpuTimer->BeginPass(passName(pass));
+            currentPass = static_cast<int>(pass);
+        }
+
+        switch (command.type) {
+            case RenderCommandType::CLEAR:
+                glClearColor(command.color[0], command.color[1], command.color[2], 1.0f);
+                glClear(GL_COLOR_BUFFER_BIT);
+                break;
+
+            case RenderCommandType::DRAW_ARRAYS:
+                // The handle was resolved at link time, and an unchanged color skips the upload.
+                // No unbind afterwards: the state cache skips re-binding the same program/VAO.
+                command.shader->Use();
+                command.shader->setUniform(command.shader->getColorUniform(),
+                                           command.color[0], command.color[1], command.color[2]);
+                command.buffer->Bind();
+                glDrawArrays(command.primitiveType, command.first, command.count);
+                break;
+
+            case RenderCommandType::DRAW_FULLSCREEN:
+                // The vertex shader derives the triangle from gl_VertexID; the VAO is empty.
+                command.shader->Use();
+                command.shader->setUniform(command.shader->getColorUniform(),
+                                           command.color[0], command.color[1], command.color[2]);
+                GLStateCache::GetInstance().BindVertexArray(m_emptyVAO);
+                glDrawArrays(command.primitiveType, command.first, command.count);
+                break;
+
+            case RenderCommandType::DRAW_TRAILS:
+                // Two uniforms per frame animate every trail; no vertex is touched.
+                m_trailShader->Use();
+                m_trailShader->setUniform(m_trailCurrentTick, frame.tick);
+                m_trailShader->setUniform(m_trailTickAlpha, frame.tickAlpha);
+                m_trailShader->setUniform(m_trailPixelSize,
+                                          static_cast<float>(m_gridWidth) / std::max(sceneWidth, 1),
+                                          static_cast<float>(m_gridHeight) / std::max(sceneHeight, 1));
+                m_trailBatch->Draw(frame.trails);
+                break;
+
+            case RenderCommandType::DRAW_QUADS:
+                m_quadShader->Use();
+                m_quadBatch->Draw(frame.quads);
+                break;
+        }
+    }
+
+    // 4. Post-process (if no HUD command did it already)
+    if (!resolved) resolveScene(frame);
+
+    // Fence the streamed instances once every draw that reads them is issued
+    m_quadBatch->EndFrame();
+
+    m_gpuTimer->EndFrame();
+
+    const std::chrono::duration<double, std::milli> executeTime = std::chrono::steady_clock::now() - executeStart;
+    m_executeMilliseconds.store(executeTime.count());
+
+    // 5. Present
+    if (frame.window) glfwSwapBuffers(frame.window);
+}
+
+void Renderer::resolveScene(const RenderFrame& frame) {
+    GLStateCache& state = GLStateCache::GetInstance();
+    if (m_bloom->isEnabled()) {
+        // Blur the bright parts and composite (upscaling) into the window
+        m_bloom->Execute(*m_gpuTimer, m_sceneTarget, frame.width, frame.height);
+    } else {
+        // Plain bilinear upscale
+        m_gpuTimer->BeginPass("upscale");
+        state.SetBlend(false);
+        RenderTarget::BindDefault(frame.width, frame.height);
+        m_upscaleShader->Use();
+        state.BindVertexArray(m_emptyVAO);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, m_sceneTarget.getTexture());
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+
+    // The HUD blends like the scene
+    state.SetBlend(true);
+    state.BlendFunc(GL_SRC_ALPHA, GL_ONE);
 }
 
 void Renderer::DrawObject(float r, float g, float b) {
@@ -73,6 +379,7 @@ void Renderer::DrawObject(float r, float g, float b) {
     // glColor3f(r, g, b); // Will be ignored by modern GL pipeline
     // glBegin(GL_QUADS); // WILL BE REMOVED!
     // ...
-    // glEnd();}
+    // glEnd();
+}
 
 } // namespace EchoDrift::Rendering
\ No newline at end of file
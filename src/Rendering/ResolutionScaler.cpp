@@ -0,0 +1,50 @@
+#include "Rendering/ResolutionScaler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace EchoDrift::Rendering {
+
+void ResolutionScaler::Configure(const DynamicResolutionSettings& settings) {
+    m_settings = settings;
+    m_settings.minScale = std::clamp(m_settings.minScale, SCALE_STEP, 1.0f);
+    m_settings.maxScale = std::clamp(m_settings.maxScale, m_settings.minScale, 1.0f);
+    m_scale = std::clamp(m_scale, m_settings.minScale, m_settings.maxScale);
+    m_cooldown = 0;
+}
+
+void ResolutionScaler::AddCpuSample(double milliseconds) {
+    m_cpuMilliseconds = m_hasCpuSample ? m_cpuMilliseconds + SMOOTHING * (milliseconds - m_cpuMilliseconds)
+                                       : milliseconds;
+    m_hasCpuSample = true;
+}
+
+void ResolutionScaler::AddGpuSample(double milliseconds) {
+    m_gpuMilliseconds = m_hasGpuSample ? m_gpuMilliseconds + SMOOTHING * (milliseconds - m_gpuMilliseconds)
+                                       : milliseconds;
+    m_hasGpuSample = true;
+
+    if (!m_settings.enabled || m_gpuMilliseconds <= 0.0) return;
+    if (m_cooldown > 0) {
+        --m_cooldown;
+        return;
+    }
+
+    // The GPU may take as long as the CPU does: the two threads overlap.
+    const double budget = std::max(m_settings.targetFrameMilliseconds, m_cpuMilliseconds) * HEADROOM;
+    if (m_gpuMilliseconds < budget && m_gpuMilliseconds > budget * GROW_BELOW) return; // Dead band
+
+    // Pixels scale with scale^2. Drop quickly (several steps under heavy
+    // overload), grow one step at a time.
+    const float ideal = m_scale * static_cast<float>(std::sqrt(budget / m_gpuMilliseconds));
+    const long steps = std::clamp(std::lround((ideal - m_scale) / SCALE_STEP), -MAX_STEPS_DOWN, 1L);
+    float next = std::round((m_scale + static_cast<float>(steps) * SCALE_STEP) / SCALE_STEP) * SCALE_STEP;
+    next = std::clamp(next, m_settings.minScale, m_settings.maxScale);
+
+    if (next != m_scale) {
+        m_scale = next;
+        // Let the new resolution show up in the (late, smoothed) GPU times first
+        m_cooldown = COOLDOWN_SAMPLES;
+    }
+}
+
+} // namespace EchoDrift::Rendering
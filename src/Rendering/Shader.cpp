@@ -1,18 +1,37 @@
 #include "Shader.h"
+#include "Rendering/ProgramBinaryCache.h"
 #include <fstream>
 #include <sstream>
+#include <algorithm>
+#include <cstring>
+#ifndef ECHODRIFT_SHADER_DIR
+#include "Rendering/EmbeddedShaders.h" // Generated from shaders/ by the build
+#endif
 
 namespace EchoDrift::Rendering {
 
 // --- Low-Level Helper Functions (Encapsulation) ---
 
+std::string Shader::loadShaderSource(const std::string& name) const {
+#ifdef ECHODRIFT_SHADER_DIR
+    // Development build (ECHODRIFT_SHADERS_FROM_DISK): edits show up on the next launch.
+    return readShaderFile(std::string(ECHODRIFT_SHADER_DIR) + "/" + name);
+#else
+    // Compiled into the executable: no file I/O, no dependency on the working directory.
+    for (const EmbeddedShaders::Entry& entry : EmbeddedShaders::ENTRIES) {
+        if (entry.name == name) return std::string(entry.source);
+    }
+    std::cerr << "ERROR::SHADER::NOT_EMBEDDED: " << name << std::endl;
+    return "";
+#endif
+}
+
 std::string Shader::readShaderFile(const std::string& filePath) const {
-    // Note: We use the assets/shaders directory structure you provided earlier.
     std::ifstream file;
     file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
     try {
         std::stringstream ss;
-        file.open("shaders/" + filePath);
+        file.open(filePath);
         ss << file.rdbuf();
         file.close();
         return ss.str();
@@ -29,14 +48,59 @@ std::string Shader::readShaderFile(const std::string& filePath) const {
 // Constructor: Loading, Compiling, Linking (Abstraction Point)
 // ------------------------------------------------------------------
 
-Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath) {
+std::string Shader::applyDefines(const std::string& source, const std::vector<std::string>& defines) {
+    if (defines.empty()) return source;
+
+    std::string block;
+    for (const std::string& define : defines) {
+        block += "#define " + define + "\n";
+    }
+
+    // #version must stay the first statement, so the defines go right after it.
+    std::size_t insertAt = 0;
+    const std::size_t version = source.find("#version");
+    if (version != std::string::npos) {
+        const std::size_t lineEnd = source.find('\n', version);
+        insertAt = lineEnd == std::string::npos ? source.size() : lineEnd + 1;
+    }
+    std::string result = source;
+    result.insert(insertAt, block);
+    return result;
+}
+
+Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath,
+               const std::vector<std::string>& defines) {
     // 1. Retrieve the shader source code from file paths
-    std::string vCode = readShaderFile(vertexPath);
-    std::string fCode = readShaderFile(fragmentPath);
-    const char* vShaderCode = vCode.c_str();
-    const char* fShaderCode = fCode.c_str();
+    std::string vCode = applyDefines(loadShaderSource(vertexPath), defines);
+    std::string fCode = applyDefines(loadShaderSource(fragmentPath), defines);
 
-    // 2. Compile shaders (Low-Level GL)
+    // 2. Warm start: the linked program straight from the binary cache,
+    // otherwise compile and link, and cache the result for next time.
+    ProgramBinaryCache& cache = ProgramBinaryCache::GetInstance();
+    const std::uint64_t cacheKey = cache.MakeKey(vCode, fCode);
+    m_programID = cache.Load(cacheKey);
+    if (m_programID != 0) {
+        std::cout << "Shader Program loaded from cache: " << vertexPath << " + " << fragmentPath << std::endl;
+    } else {
+        m_programID = linkFromSource(vCode, fCode);
+        cache.Store(cacheKey, m_programID);
+        std::cout << "Shader Program linked successfully." << std::endl;
+    }
+
+    // 3. Build the uniform location table once, instead of querying per draw
+    reflectUniforms();
+    auto color = m_uniforms.find("uColor");
+    if (color != m_uniforms.end() && color->second.type == GL_FLOAT_VEC3) {
+        m_colorUniform.location = color->second.location;
+        m_colorUniform.slot = color->second.slot;
+    }
+}
+
+GLuint Shader::linkFromSource(const std::string& vertexSource, const std::string& fragmentSource) const {
+    const char* vShaderCode = vertexSource.c_str();
+    const char* fShaderCode = fragmentSource.c_str();
+
+    // 1. Compile shaders (Low-Level GL)
     GLuint vertex, fragment;
     
     vertex = glCreateShader(GL_VERTEX_SHADER);
@@ -49,29 +113,172 @@ Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath) {
     glCompileShader(fragment);
     // checkCompileErrors(fragment, "FRAGMENT"); // Always check errors!
 
-    // 3. Link the program (Low-Level GL)
-    m_programID = glCreateProgram();
-    glAttachShader(m_programID, vertex);
-    glAttachShader(m_programID, fragment);
-    glLinkProgram(m_programID);
-    // checkLinkErrors(m_programID); // Always check errors!
+    // 2. Link the program (Low-Level GL), keeping the binary retrievable for the cache
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertex);
+    glAttachShader(program, fragment);
+    ProgramBinaryCache::GetInstance().PrepareForLink(program);
+    glLinkProgram(program);
+    // checkLinkErrors(program); // Always check errors!
 
-    // 4. Delete shaders as they are now linked into the program (Cleanup)
+    // 3. Delete shaders as they are now linked into the program (Cleanup)
     glDeleteShader(vertex);
     glDeleteShader(fragment);
-    
-    std::cout << "Shader Program linked successfully." << std::endl;
+    return program;
 }
 
 Shader::~Shader() {
     // RAII: Clean up the GL resource when the C++ object is destroyed.
-    glDeleteProgram(m_programID);
+    GLStateCache::GetInstance().DeleteProgram(m_programID);
+}
+
+// ------------------------------------------------------------------
+// Uniform Reflection
+// ------------------------------------------------------------------
+
+void Shader::reflectUniforms() {
+    m_uniforms.clear();
+    m_lastValues.clear();
+
+    GLint count = 0;
+    GLint maxNameLength = 0;
+    glGetProgramiv(m_programID, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(m_programID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+    std::vector<GLchar> nameBuffer(static_cast<std::size_t>(std::max(maxNameLength, 1)));
+    for (GLint i = 0; i < count; ++i) {
+        GLsizei length = 0;
+        GLint arraySize = 0;
+        GLenum type = 0;
+        glGetActiveUniform(m_programID, static_cast<GLuint>(i), static_cast<GLsizei>(nameBuffer.size()),
+                           &length, &arraySize, &type, nameBuffer.data());
+
+        std::string name(nameBuffer.data(), static_cast<std::size_t>(length));
+        // Arrays are reported as "name[0]"; register them under the bare name.
+        if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0) {
+            name.resize(name.size() - 3);
+        }
+
+        // Members of uniform blocks have no location and are skipped.
+        GLint location = glGetUniformLocation(m_programID, name.c_str());
+        if (location < 0) continue;
+
+        m_uniforms[name] = {location, type, arraySize, static_cast<int>(m_lastValues.size())};
+        m_lastValues.emplace_back();
+    }
+}
+
+namespace {
+
+// Every non-opaque uniform type GLSL has (scalars, vectors, matrices).
+// Anything else is an opaque handle (sampler, image, atomic counter) of some
+// dimensionality/format, all of which are set with glUniform1i, so new
+// sampler kinds need no list of their own.
+bool isOpaqueType(GLenum type) {
+    switch (type) {
+        case GL_FLOAT: case GL_FLOAT_VEC2: case GL_FLOAT_VEC3: case GL_FLOAT_VEC4:
+        case GL_DOUBLE: case GL_DOUBLE_VEC2: case GL_DOUBLE_VEC3: case GL_DOUBLE_VEC4:
+        case GL_INT: case GL_INT_VEC2: case GL_INT_VEC3: case GL_INT_VEC4:
+        case GL_UNSIGNED_INT: case GL_UNSIGNED_INT_VEC2: case GL_UNSIGNED_INT_VEC3: case GL_UNSIGNED_INT_VEC4:
+        case GL_BOOL: case GL_BOOL_VEC2: case GL_BOOL_VEC3: case GL_BOOL_VEC4:
+        case GL_FLOAT_MAT2: case GL_FLOAT_MAT3: case GL_FLOAT_MAT4:
+        case GL_FLOAT_MAT2x3: case GL_FLOAT_MAT2x4: case GL_FLOAT_MAT3x2:
+        case GL_FLOAT_MAT3x4: case GL_FLOAT_MAT4x2: case GL_FLOAT_MAT4x3:
+        case GL_DOUBLE_MAT2: case GL_DOUBLE_MAT3: case GL_DOUBLE_MAT4:
+        case GL_DOUBLE_MAT2x3: case GL_DOUBLE_MAT2x4: case GL_DOUBLE_MAT3x2:
+        case GL_DOUBLE_MAT3x4: case GL_DOUBLE_MAT4x2: case GL_DOUBLE_MAT4x3:
+            return false;
+        default:
+            return true;
+    }
+}
+
+} // namespace
+
+const Shader::UniformInfo* Shader::findUniform(const std::string& name, GLenum expectedType) const {
+    auto it = m_uniforms.find(name);
+    if (it == m_uniforms.end()) {
+        // Not necessarily an error: the compiler strips uniforms the shader never reads.
+        std::cerr << "WARNING::SHADER::UNIFORM_NOT_ACTIVE: " << name << std::endl;
+        return nullptr;
+    }
+
+    GLenum type = it->second.type;
+    const bool isSampler = isOpaqueType(type);
+    if (type != expectedType && !(expectedType == GL_INT && isSampler)) {
+        std::cerr << "WARNING::SHADER::UNIFORM_TYPE_MISMATCH: " << name << std::endl;
+        return nullptr;
+    }
+    return &it->second;
+}
+
+bool Shader::storeIfChanged(int slot, const void* value, std::size_t bytes) const {
+    CachedValue& cached = m_lastValues[static_cast<std::size_t>(slot)];
+    if (cached.valid && std::memcmp(cached.data.data(), value, bytes) == 0) {
+        return false;
+    }
+    std::memcpy(cached.data.data(), value, bytes);
+    cached.valid = true;
+    return true;
+}
+
+// ------------------------------------------------------------------
+// Uniform Setters
+// ------------------------------------------------------------------
+
+void Shader::setUniform(UniformInt uniform, GLint value) const {
+    if (uniform.isValid() && storeIfChanged(uniform.slot, &value, sizeof(value))) {
+        glUniform1i(uniform.location, value);
+    }
+}
+
+void Shader::setUniform(UniformUint uniform, GLuint value) const {
+    if (uniform.isValid() && storeIfChanged(uniform.slot, &value, sizeof(value))) {
+        glUniform1ui(uniform.location, value);
+    }
+}
+
+void Shader::setUniform(UniformFloat uniform, float value) const {
+    if (uniform.isValid() && storeIfChanged(uniform.slot, &value, sizeof(value))) {
+        glUniform1f(uniform.location, value);
+    }
+}
+
+void Shader::setUniform(UniformVec2 uniform, float x, float y) const {
+    const GLfloat value[2] = {x, y};
+    if (uniform.isValid() && storeIfChanged(uniform.slot, value, sizeof(value))) {
+        glUniform2fv(uniform.location, 1, value);
+    }
+}
+
+void Shader::setUniform(UniformVec3 uniform, float x, float y, float z) const {
+    const GLfloat value[3] = {x, y, z};
+    if (uniform.isValid() && storeIfChanged(uniform.slot, value, sizeof(value))) {
+        glUniform3fv(uniform.location, 1, value);
+    }
+}
+
+void Shader::setUniform(UniformVec4 uniform, float x, float y, float z, float w) const {
+    const GLfloat value[4] = {x, y, z, w};
+    if (uniform.isValid() && storeIfChanged(uniform.slot, value, sizeof(value))) {
+        glUniform4fv(uniform.location, 1, value);
+    }
+}
+
+void Shader::setUniform(UniformMat4 uniform, const GLfloat* columnMajor) const {
+    if (uniform.isValid() && storeIfChanged(uniform.slot, columnMajor, 16 * sizeof(GLfloat))) {
+        glUniformMatrix4fv(uniform.location, 1, GL_FALSE, columnMajor);
+    }
 }
 
 void Shader::setUniformFloat(const std::string& name, float value) const {
-    // Abstraction: Get the location and set the uniform, hiding the glGetUniformLocation
+    // Abstraction: resolve through the reflected table, hiding the location
     // and glUniform1f complexity from other classes.
-    glUniform1f(glGetUniformLocation(m_programID, name.c_str()), value);
+    setUniform(getUniformFloat(name), value);
+}
+
+void Shader::setUniformVec2(const std::string& name, float x, float y) const {
+    setUniform(getUniformVec2(name), x, y);
 }
 
 } // namespace EchoDrift::Rendering
\ No newline at end of file
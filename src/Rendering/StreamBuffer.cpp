@@ -0,0 +1,150 @@
+#include "Rendering/StreamBuffer.h"
+#include <iostream>
+
+namespace EchoDrift::Rendering {
+
+// ------------------------------------------------------------------
+// Constructor/Destructor (RAII)
+// ------------------------------------------------------------------
+
+StreamBuffer::StreamBuffer(GLsizeiptr regionBytes) {
+    m_persistent = GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage;
+    createStorage(regionBytes);
+
+    std::cout << "StreamBuffer created (" << (m_persistent ? "persistent mapped" : "orphaning fallback") << ")." << std::endl;
+}
+
+StreamBuffer::~StreamBuffer() {
+    destroyStorage();
+}
+
+void StreamBuffer::createStorage(GLsizeiptr regionBytes) {
+    m_regionBytes = regionBytes;
+    glGenBuffers(1, &m_VBO);
+    GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, m_VBO);
+
+    if (m_persistent) {
+        // Immutable storage, mapped once for the lifetime of the buffer.
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_ARRAY_BUFFER, m_regionBytes * REGION_COUNT, nullptr, flags);
+        m_mappedBase = static_cast<char*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, m_regionBytes * REGION_COUNT, flags));
+        if (!m_mappedBase) {
+            // Immutable storage cannot be re-specified, so start over with a fresh VBO.
+            std::cerr << "ERROR::STREAM_BUFFER::PERSISTENT_MAP_FAILED: falling back to orphaning" << std::endl;
+            m_persistent = false;
+            GLStateCache::GetInstance().DeleteBuffer(m_VBO);
+            glGenBuffers(1, &m_VBO);
+            GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, m_VBO);
+        }
+    }
+    if (!m_persistent) {
+        glBufferData(GL_ARRAY_BUFFER, m_regionBytes, nullptr, GL_STREAM_DRAW);
+    }
+
+    GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void StreamBuffer::destroyStorage() {
+    // Draws already issued keep their storage alive; nothing needs to wait here.
+    for (GLsync& fence : m_fences) {
+        if (fence) glDeleteSync(fence);
+        fence = nullptr;
+    }
+    if (m_VBO) {
+        if (m_mappedBase || m_mappedForWrite) {
+            GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, m_VBO);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+            GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+        GLStateCache::GetInstance().DeleteBuffer(m_VBO);
+        m_VBO = 0;
+    }
+    m_mappedBase = nullptr;
+    m_mappedForWrite = false;
+    m_region = 0;
+    m_regionReady = false;
+}
+
+// ------------------------------------------------------------------
+// Per-Frame Streaming
+// ------------------------------------------------------------------
+
+void StreamBuffer::beginRegion() {
+    if (m_persistent) {
+        // Wait until the GPU has finished reading this region (three frames ago).
+        GLsync& fence = m_fences[m_region];
+        if (fence) {
+            GLenum status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+            while (status == GL_TIMEOUT_EXPIRED) {
+                status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1 ms
+            }
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    } else {
+        // Orphan: the driver hands us fresh storage while the GPU keeps the old one.
+        GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, m_VBO);
+        glBufferData(GL_ARRAY_BUFFER, m_regionBytes, nullptr, GL_STREAM_DRAW);
+    }
+    m_offset = 0;
+    m_regionReady = true;
+}
+
+void* StreamBuffer::Allocate(GLsizeiptr bytes, GLintptr& offset) {
+    if (bytes <= 0) return nullptr;
+    if (!m_regionReady) beginRegion();
+
+    GLsizeiptr start = (m_offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    if (start + bytes > m_regionBytes) {
+        // Out of room this frame. The draws issued so far already reference the
+        // old buffer, so it can simply be orphaned for a bigger one.
+        GLsizeiptr grown = m_regionBytes * 2;
+        while (grown < bytes) grown *= 2;
+        destroyStorage();
+        createStorage(grown);
+        beginRegion();
+        start = 0;
+    }
+
+    const GLsizeiptr regionStart = m_persistent ? m_region * m_regionBytes : 0;
+    offset = static_cast<GLintptr>(regionStart + start);
+
+    void* data = nullptr;
+    if (m_persistent) {
+        data = m_mappedBase + regionStart + start;
+    } else {
+        // Freshly orphaned storage: nobody else is using this range, no sync needed.
+        GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, m_VBO);
+        data = glMapBufferRange(GL_ARRAY_BUFFER, start, bytes,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        m_mappedForWrite = (data != nullptr);
+        if (!data) {
+            std::cerr << "ERROR::STREAM_BUFFER::MAP_FAILED" << std::endl;
+            return nullptr;
+        }
+    }
+
+    m_offset = start + bytes;
+    return data;
+}
+
+void StreamBuffer::Commit() {
+    // Coherent persistent mappings need nothing; the fallback must unmap before drawing.
+    if (m_mappedForWrite) {
+        GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, m_VBO);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        m_mappedForWrite = false;
+    }
+}
+
+void StreamBuffer::EndFrame() {
+    if (!m_regionReady) return; // Nothing streamed this frame
+
+    if (m_persistent) {
+        m_fences[m_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        m_region = (m_region + 1) % REGION_COUNT;
+    }
+    m_regionReady = false;
+}
+
+} // namespace EchoDrift::Rendering
@@ -0,0 +1,265 @@
+#include "Rendering/TrailBatch.h"
+#include "Rendering/GLStateCache.h"
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+
+namespace EchoDrift::Rendering {
+
+namespace {
+
+constexpr GLsizeiptr VERTEX_BYTES = sizeof(TrailVertex);
+constexpr GLsizei MIN_BUFFER_VERTICES = 1024;
+constexpr GLsizei MIN_RANGE_VERTICES = 8;
+constexpr GLint TEXELS_PER_VERTEX = static_cast<GLint>(sizeof(TrailVertex) / sizeof(GLuint)); // R32UI
+
+} // namespace
+
+// ------------------------------------------------------------------
+// Constructor/Destructor (RAII)
+// ------------------------------------------------------------------
+
+TrailBatch::TrailBatch() {
+    // The VAO stays empty: core profile needs one bound to draw at all.
+    glGenVertexArrays(1, &m_VAO);
+    glGenBuffers(1, &m_VBO);
+    glGenTextures(1, &m_texture);
+
+    // The shader fetches every vertex through the buffer texture, so its size
+    // limit is the batch's.
+    GLint maxTexels = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels);
+    m_maxVertices = std::max(maxTexels, 65536) / TEXELS_PER_VERTEX;
+
+    repack(std::min(MIN_BUFFER_VERTICES, m_maxVertices));
+}
+
+TrailBatch::~TrailBatch() {
+    if (m_texture) glDeleteTextures(1, &m_texture);
+    if (m_VAO) GLStateCache::GetInstance().DeleteVertexArray(m_VAO);
+    if (m_VBO) GLStateCache::GetInstance().DeleteBuffer(m_VBO);
+}
+
+// ------------------------------------------------------------------
+// Layout Management (game thread, CPU image only)
+// ------------------------------------------------------------------
+
+void TrailBatch::repack(GLsizei newCapacity, RangeId last) {
+    // Copy each live range into the new image, packed back to back (dead space is dropped)
+    std::vector<TrailVertex> image(static_cast<std::size_t>(newCapacity));
+    GLint top = 0;
+    auto place = [&](Range& range) {
+        std::copy_n(m_image.begin() + range.first, range.count, image.begin() + top);
+        range.first = top;
+        top += range.capacity;
+    };
+    for (RangeId id = 0; id < m_ranges.size(); ++id) {
+        if (m_ranges[id].inUse && id != last) place(m_ranges[id]);
+    }
+    if (last != NO_RANGE) place(m_ranges[last]);
+
+    m_image.swap(image);
+    m_top = top;
+    m_deadVertices = 0;
+
+    // The GL thread re-sends the whole image next frame.
+    m_repacked = true;
+    m_dirty.clear();
+}
+
+GLint TrailBatch::allocate(GLsizei vertexCount) {
+    const GLsizei capacity = static_cast<GLsizei>(m_image.size());
+    if (m_top + vertexCount > capacity) {
+        // Pack, and grow so at least half the buffer is free afterwards:
+        // every repack is paid for by as many appends as it copies.
+        // At the texture limit only packing is left.
+        const GLsizei live = m_top - m_deadVertices;
+        if (live + vertexCount > m_maxVertices) return -1;
+        GLsizei newCapacity = std::max(capacity, MIN_BUFFER_VERTICES);
+        while (newCapacity < 2 * (live + vertexCount) && newCapacity < m_maxVertices) newCapacity *= 2;
+        repack(std::min(newCapacity, m_maxVertices));
+    }
+
+    const GLint first = m_top;
+    m_top += vertexCount;
+    return first;
+}
+
+bool TrailBatch::extendAtLimit(RangeId id, GLsizei vertexCount) {
+    const GLsizei capacity = static_cast<GLsizei>(m_image.size());
+    if (m_top - m_deadVertices + vertexCount > capacity) return false;
+
+    // Doubling into a second copy no longer fits, so the range must grow where it is.
+    if (m_ranges[id].first + m_ranges[id].capacity != m_top || m_top + vertexCount > capacity) {
+        repack(capacity, id);
+    }
+    m_top += vertexCount;
+    m_ranges[id].capacity += vertexCount;
+    return true;
+}
+
+void TrailBatch::write(GLint vertexIndex, const TrailVertex& vertex) {
+    m_image[static_cast<std::size_t>(vertexIndex)] = vertex;
+    if (!m_repacked) m_dirty.push_back(vertexIndex);
+}
+
+// ------------------------------------------------------------------
+// Ranges
+// ------------------------------------------------------------------
+
+TrailBatch::RangeId TrailBatch::CreateRange() {
+    RangeId id;
+    if (!m_freeIds.empty()) {
+        id = m_freeIds.back();
+        m_freeIds.pop_back();
+    } else {
+        id = static_cast<RangeId>(m_ranges.size());
+        m_ranges.emplace_back();
+    }
+
+    // Empty until the first Append reserves space.
+    m_ranges[id] = Range{};
+    m_ranges[id].inUse = true;
+    return id;
+}
+
+void TrailBatch::DestroyRange(RangeId id) {
+    Range& range = m_ranges[id];
+    if (!range.inUse) return;
+
+    m_deadVertices += range.capacity;
+    range = Range{};
+    m_freeIds.push_back(id);
+}
+
+void TrailBatch::Append(RangeId id, const TrailVertex& vertex) {
+    if (m_ranges[id].count == m_ranges[id].capacity) {
+        // Full: move to a range twice the size at the top of the buffer.
+        const GLsizei newCapacity = std::max(2 * m_ranges[id].capacity, MIN_RANGE_VERTICES);
+        const GLint newFirst = allocate(newCapacity); // May repack, which moves range.first
+        if (newFirst >= 0) {
+            Range& range = m_ranges[id];
+            for (GLsizei i = 0; i < range.count; ++i) {
+                write(newFirst + i, m_image[static_cast<std::size_t>(range.first + i)]);
+            }
+            m_deadVertices += range.capacity;
+            range.first = newFirst;
+            range.capacity = newCapacity;
+        } else {
+            // Texture limit: grow in small steps into whatever packing frees.
+            if (m_image.size() < static_cast<std::size_t>(m_maxVertices)) repack(m_maxVertices);
+            if (!extendAtLimit(id, MIN_RANGE_VERTICES)) {
+                if (!m_limitReported) {
+                    std::cerr << "WARNING::TRAIL_BATCH::TEXTURE_BUFFER_FULL: trails stop growing at "
+                              << m_maxVertices << " vertices" << std::endl;
+                    m_limitReported = true;
+                }
+                return;
+            }
+        }
+    }
+
+    Range& range = m_ranges[id];
+    write(range.first + range.count, vertex);
+    ++range.count;
+}
+
+void TrailBatch::UpdateVertex(RangeId id, GLsizei index, const TrailVertex& vertex) {
+    const Range& range = m_ranges[id];
+    if (index < 0 || index >= range.count) return;
+    write(range.first + index, vertex);
+}
+
+void TrailBatch::DropFront(RangeId id, GLsizei vertexCount) {
+    Range& range = m_ranges[id];
+    vertexCount = std::min(vertexCount, range.count);
+
+    // The dropped slots become dead space until the next repack.
+    range.first += vertexCount;
+    range.count -= vertexCount;
+    range.capacity -= vertexCount;
+    m_deadVertices += vertexCount;
+}
+
+// ------------------------------------------------------------------
+// Frame Hand-Off
+// ------------------------------------------------------------------
+
+void TrailBatch::Submit(RangeId id) {
+    // Segment i of the buffer starts at vertex i * TRAIL_SEGMENT_VERTICES; the
+    // range's last vertex starts no segment (it only ends the one before it).
+    const Range& range = m_ranges[id];
+    if (range.count < 2) return;
+    m_drawFirsts.push_back(range.first * TRAIL_SEGMENT_VERTICES);
+    m_drawCounts.push_back((range.count - 1) * TRAIL_SEGMENT_VERTICES);
+}
+
+void TrailBatch::TakeFrame(TrailFrame& frame) {
+    frame.Clear();
+    frame.capacity = static_cast<GLsizei>(m_image.size());
+
+    if (m_repacked) {
+        // Everything below the top (the rest of the image is unused)
+        frame.fullUpload = true;
+        frame.vertices.assign(m_image.begin(), m_image.begin() + m_top);
+    } else {
+        // Only what changed, each vertex once, in buffer order
+        std::sort(m_dirty.begin(), m_dirty.end());
+        m_dirty.erase(std::unique(m_dirty.begin(), m_dirty.end()), m_dirty.end());
+        frame.dirtyIndices.assign(m_dirty.begin(), m_dirty.end());
+        frame.vertices.reserve(m_dirty.size());
+        for (GLint index : m_dirty) {
+            frame.vertices.push_back(m_image[static_cast<std::size_t>(index)]);
+        }
+    }
+    m_dirty.clear();
+    m_repacked = false;
+
+    frame.firsts.swap(m_drawFirsts);
+    frame.counts.swap(m_drawCounts);
+    m_drawFirsts.clear();
+    m_drawCounts.clear();
+}
+
+// ------------------------------------------------------------------
+// GL Thread
+// ------------------------------------------------------------------
+
+void TrailBatch::Upload(const TrailFrame& frame) {
+    GLStateCache::GetInstance().BindBuffer(GL_ARRAY_BUFFER, m_VBO);
+
+    if (frame.fullUpload) {
+        // Orphan + refill; same buffer object, so the VAO stays valid.
+        glBufferData(GL_ARRAY_BUFFER, frame.capacity * VERTEX_BYTES, nullptr, GL_DYNAMIC_DRAW);
+        if (!frame.vertices.empty()) {
+            glBufferSubData(GL_ARRAY_BUFFER, 0, frame.vertices.size() * VERTEX_BYTES, frame.vertices.data());
+        }
+
+        // Re-attach so the texture's size follows the new data store.
+        glBindTexture(GL_TEXTURE_BUFFER, m_texture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_R32UI, m_VBO);
+        return;
+    }
+
+    // One glBufferSubData per run of consecutive dirty vertices.
+    const std::size_t dirtyCount = frame.dirtyIndices.size();
+    std::size_t runStart = 0;
+    for (std::size_t i = 1; i <= dirtyCount; ++i) {
+        if (i < dirtyCount && frame.dirtyIndices[i] == frame.dirtyIndices[i - 1] + 1) continue;
+        glBufferSubData(GL_ARRAY_BUFFER, frame.dirtyIndices[runStart] * VERTEX_BYTES,
+                        (i - runStart) * VERTEX_BYTES, &frame.vertices[runStart]);
+        runStart = i;
+    }
+}
+
+void TrailBatch::Draw(const TrailFrame& frame) {
+    if (frame.firsts.empty()) return;
+
+    GLStateCache::GetInstance().BindVertexArray(m_VAO);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, m_texture);
+    glMultiDrawArrays(GL_TRIANGLES, frame.firsts.data(), frame.counts.data(),
+                      static_cast<GLsizei>(frame.firsts.size()));
+}
+
+} // namespace EchoDrift::Rendering